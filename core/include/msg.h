@@ -237,6 +237,44 @@ int msg_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_try_send(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send multiple messages to the same thread (blocking).
+ *
+ * Sends the messages in @p m in order, as if @ref msg_send() was called for
+ * each of them. All messages that fit into the receiver's message queue are
+ * delivered within one critical section and the receiver is scheduled at most
+ * once. Only if the queue runs full, this function blocks for the next
+ * message to be received.
+ *
+ * If called from an interrupt, this function will never block and stops at
+ * the first message that could not be delivered.
+ *
+ * @param[in] m             Array of @p numof preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] numof         Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return number of messages delivered
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid);
+
+/**
+ * @brief Send multiple messages to the same thread (non-blocking).
+ *
+ * Same as @ref msg_send_many(), but stops at the first message that can
+ * neither be handed to the receiver nor queued, instead of blocking.
+ *
+ * @param[in] m             Array of @p numof preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] numof         Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return number of messages delivered
+ * @return -1, on error (invalid PID)
+ */
+int msg_try_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message to the current thread.
  * @details Will work only if the thread has a message queue.
@@ -314,6 +352,42 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages.
+ *
+ * This function blocks until at least one message was received. It then
+ * takes up to @p max messages from the message queue (and from threads
+ * blocked sending to this thread) within one critical section. The messages
+ * are received in the same order as with repeated calls to
+ * @ref msg_receive(). Blocked senders woken up in the process cause at most
+ * one context switch.
+ *
+ * @pre `max > 0`
+ *
+ * @param[out] buf  Array of at least @p max ``msg_t`` structures, must not be
+ *                  NULL.
+ * @param[in] max   Maximum number of messages to receive.
+ *
+ * @return  Number of messages received, at least 1.
+ */
+int msg_receive_many(msg_t *buf, unsigned max);
+
+/**
+ * @brief Try to receive multiple messages.
+ *
+ * Same as @ref msg_receive_many(), but does not block if no message can be
+ * received.
+ *
+ * @pre `max > 0`
+ *
+ * @param[out] buf  Array of at least @p max ``msg_t`` structures, must not be
+ *                  NULL.
+ * @param[in] max   Maximum number of messages to receive.
+ *
+ * @return  Number of messages received, 0 if none was available.
+ */
+int msg_try_receive_many(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -340,6 +340,47 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if IS_USED(MODULE_SCHED_LATENCY) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler wakeup hook of the @ref sched_latency module
+ *
+ * Called with interrupts disabled when @p thread is put on a run queue.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread that became runnable
+ */
+extern void sched_latency_wakeup_cb(const thread_t *thread);
+
+/**
+ * @brief   Scheduler run hook of the @ref sched_latency module
+ *
+ * Called on every scheduler run with the thread selected to run next.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread about to run
+ */
+extern void sched_latency_run_cb(const thread_t *thread);
+
+/**
+ * @brief   Scheduler preemption hook of the @ref sched_latency module
+ *
+ * Called when @p thread is descheduled while it is still runnable.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread that got preempted
+ */
+extern void sched_latency_preempt_cb(const thread_t *thread);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
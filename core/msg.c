@@ -178,6 +178,80 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
     return 1;
 }
 
+static int _msg_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid,
+                          bool block)
+{
+    int sent = 0;
+
+    if (irq_is_in() || (thread_getpid() == target_pid)) {
+        /* neither can block, so there is nothing to batch */
+        int res = 1;
+
+        while ((sent < (int)numof) &&
+               ((res = msg_try_send(&m[sent], target_pid)) > 0)) {
+            sent++;
+        }
+        return (res < 0) ? res : sent;
+    }
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+    bool wake = false;
+
+    while (sent < (int)numof) {
+        if (target == NULL) {
+            DEBUG("msg_send_many(): target thread %d does not exist\n",
+                  target_pid);
+            irq_restore(state);
+            return (sent > 0) ? sent : -1;
+        }
+
+        msg_t *cur = &m[sent];
+
+        cur->sender_pid = thread_getpid();
+        if (target->status == STATUS_RECEIVE_BLOCKED) {
+            /* copy msg to target, it will pick up the rest from its queue */
+            *((msg_t *)target->wait_data) = *cur;
+            sched_set_status(target, STATUS_PENDING);
+            wake = true;
+        }
+        else if (!queue_msg(target, cur)) {
+            if (!block) {
+                break;
+            }
+            /* queue is full: send this one blocking, which lets the target
+             * run and drain its queue */
+            _msg_send(cur, target_pid, true, state);
+            wake = false;
+            state = irq_disable();
+            target = thread_get_unchecked(target_pid);
+        }
+        sent++;
+    }
+
+    uint16_t target_prio = (target != NULL) ? target->priority
+                                            : THREAD_PRIORITY_IDLE;
+
+    irq_restore(state);
+    if (wake) {
+        sched_switch(target_prio);
+    }
+    else if (IS_USED(MODULE_CORE_THREAD_FLAGS) && sched_context_switch_request) {
+        thread_yield_higher();
+    }
+    return sent;
+}
+
+int msg_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid)
+{
+    return _msg_send_many(m, numof, target_pid, true);
+}
+
+int msg_try_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid)
+{
+    return _msg_send_many(m, numof, target_pid, false);
+}
+
 int msg_send_to_self(msg_t *m)
 {
     unsigned state = irq_disable();
@@ -437,6 +511,91 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* Takes up to max messages from the queue of me, refilling the queue from
+ * send blocked threads as _msg_receive() does. Must be called with interrupts
+ * disabled. *prio is lowered to the priority of any sender woken up. */
+static unsigned _msg_drain(thread_t *me, msg_t *buf, unsigned max,
+                           uint16_t *prio)
+{
+    unsigned n = 0;
+
+    while (n < max) {
+        int queue_index = -1;
+
+        if (thread_has_msg_queue(me)) {
+            queue_index = cib_get(&(me->msg_queue));
+        }
+        if (queue_index >= 0) {
+            buf[n++] = me->msg_array[queue_index];
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+
+        if (next == NULL) {
+            if (queue_index < 0) {
+                break;
+            }
+            continue;
+        }
+
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+        msg_t *m = (queue_index >= 0)
+                 ? &(me->msg_array[cib_put(&(me->msg_queue))])
+                 : &buf[n++];
+
+        *m = *((msg_t *)sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < *prio) {
+                *prio = sender->priority;
+            }
+        }
+    }
+
+    return n;
+}
+
+static int _msg_receive_many(msg_t *buf, unsigned max, int block)
+{
+    assert((buf != NULL) && (max > 0));
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = _msg_drain(me, buf, max, &sender_prio);
+
+    if ((n == 0) && block) {
+        DEBUG("_msg_receive_many(): %" PRIkernel_pid ": No msg in queue. "
+              "Going blocked.\n", thread_getpid());
+        me->wait_data = (void *)buf;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied the first message, collect what got queued since */
+        state = irq_disable();
+        n = 1 + _msg_drain(me, &buf[1], max - 1, &sender_prio);
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return n;
+}
+
+int msg_receive_many(msg_t *buf, unsigned max)
+{
+    return _msg_receive_many(buf, max, 1);
+}
+
+int msg_try_receive_many(msg_t *buf, unsigned max)
+{
+    return _msg_receive_many(buf, max, 0);
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
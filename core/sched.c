@@ -119,6 +119,9 @@ static void _unschedule(thread_t *active_thread)
 {
     if (active_thread->status == STATUS_RUNNING) {
         active_thread->status = STATUS_PENDING;
+#if IS_USED(MODULE_SCHED_LATENCY)
+        sched_latency_preempt_cb(active_thread);
+#endif
     }
 
 #if IS_ACTIVE(SCHED_TEST_STACK)
@@ -176,6 +179,10 @@ thread_t *__attribute__((used)) sched_run(void)
 
     next_thread->status = STATUS_RUNNING;
 
+#if IS_USED(MODULE_SCHED_LATENCY)
+    sched_latency_run_cb(next_thread);
+#endif
+
     if (previous_thread == next_thread) {
 #ifdef MODULE_SCHED_CB
         /* Call the sched callback again only if the active thread is NULL. When
@@ -264,6 +271,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+#if IS_USED(MODULE_SCHED_LATENCY)
+            sched_latency_wakeup_cb(process);
+#endif
         }
     }
     else {
@@ -15,20 +15,43 @@
  */
 
 #include <err.h>
+#include <errno.h>
 #include <signal.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <poll.h>
 
+#ifdef __linux__
+#  include <sys/epoll.h>
+#  include <sys/prctl.h>
+#endif
+
 #include "async_read.h"
+#include "container.h"
 #include "native_internal.h"
 
 static int _next_index;
 static struct pollfd _fds[ASYNC_READ_NUMOF];
 static async_read_t pollers[ASYNC_READ_NUMOF];
 
-static void _sigio_child(int fd);
+#ifdef __linux__
+/* All file descriptors registered with native_async_read_add_int_handler()
+ * share one epoll instance. A single helper process waits on it and raises
+ * SIGIO in the RIOT process for each batch of events. The instance is shared
+ * across fork(), so descriptors can be added and re-armed from the RIOT
+ * process while the helper is running. Regular files can't be added to epoll,
+ * they are always ready: for them the RIOT process writes to a pipe watched
+ * by the helper instead of signalling itself from within its handler. */
+static int _epoll_fd = -1;
+static int _kick_fd[2] = { -1, -1 };
+static pid_t _reactor_pid;
+
+static void _reactor_start(void);
+#else
+static void _sigio_child(int index);
+#endif
 
 static void _async_io_isr(void) {
     if (real_poll(_fds, _next_index, 0) > 0) {
@@ -53,17 +76,64 @@ void native_async_read_cleanup(void) {
         if (_fds[i].fd != STDIN_FILENO) {
             real_close(_fds[i].fd);
         }
+#ifndef __linux__
         if (pollers[i].child_pid) {
             kill(pollers[i].child_pid, SIGKILL);
         }
+#endif
+    }
+
+#ifdef __linux__
+    if (_reactor_pid) {
+        kill(_reactor_pid, SIGKILL);
+        _reactor_pid = 0;
+    }
+    if (_epoll_fd >= 0) {
+        real_close(_epoll_fd);
+        real_close(_kick_fd[0]);
+        real_close(_kick_fd[1]);
+        _epoll_fd = -1;
+    }
+#endif
+}
+
+#ifdef __linux__
+static int _reactor_arm(int fd, int op)
+{
+    struct epoll_event ev = {
+        .events = EPOLLIN | EPOLLPRI | EPOLLONESHOT,
+        .data.fd = fd,
+    };
+
+    return epoll_ctl(_epoll_fd, op, fd, &ev);
+}
+
+static void _reactor_kick(void)
+{
+    /* a full pipe already means a wakeup is pending */
+    if ((real_write(_kick_fd[1], "", 1) == -1) && (errno != EAGAIN)) {
+        err(EXIT_FAILURE, "native_async_read: write");
     }
 }
+#endif
 
 void native_async_read_continue(int fd) {
     for (int i = 0; i < _next_index; i++) {
-        if (_fds[i].fd == fd && pollers[i].child_pid) {
-            kill(pollers[i].child_pid, SIGCONT);
+        if (_fds[i].fd != fd || !pollers[i].interrupt) {
+            continue;
+        }
+#ifdef __linux__
+        if (pollers[i].child_pid) {
+            if (_reactor_arm(fd, EPOLL_CTL_MOD) == -1) {
+                err(EXIT_FAILURE, "native_async_read_continue(): epoll_ctl");
+            }
         }
+        else {
+            _reactor_kick();
+        }
+#else
+        kill(pollers[i].child_pid, SIGCONT);
+#endif
     }
 }
 
@@ -73,6 +143,7 @@ static void _add_handler(int fd, void *arg, native_async_read_callback_t handler
     async_read_t *poll = &pollers[_next_index];
 
     poll->child_pid = 0;
+    poll->interrupt = false;
     poll->cb = handler;
     poll->arg = arg;
     poll->fd = &_fds[_next_index];
@@ -99,30 +170,44 @@ void native_async_read_add_handler(int fd, void *arg, native_async_read_callback
 
 void native_async_read_remove_handler(int fd)
 {
-    int res = real_fcntl(fd, F_GETFL);
-    if (res < 0) {
-        err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_GETFL)");
-    }
-    unsigned flags = (unsigned)res & ~O_ASYNC;
-    res = real_fcntl(fd, F_SETFL, flags);
-    if (res < 0) {
-        err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_SETFL)");
-    }
-
     unsigned i;
     for (i = 0; (i < (unsigned)_next_index) && (_fds[i].fd != fd); i++) { };
     if (i == (unsigned)_next_index) {
         return;
     }
 
+    if (pollers[i].interrupt) {
+#ifdef __linux__
+        if (pollers[i].child_pid) {
+            epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        }
+#else
+        kill(pollers[i].child_pid, SIGKILL);
+#endif
+    }
+    else {
+        int res = real_fcntl(fd, F_GETFL);
+        if (res < 0) {
+            err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_GETFL)");
+        }
+        unsigned flags = (unsigned)res & ~O_ASYNC;
+        res = real_fcntl(fd, F_SETFL, flags);
+        if (res < 0) {
+            err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_SETFL)");
+        }
+    }
+
     native_unregister_interrupt(SIGIO);
     for (; i < (unsigned)_next_index - 1; i++) {
         _fds[i] = _fds[i + 1];
+        pollers[i] = pollers[i + 1];
+        pollers[i].fd = &_fds[i];
     }
     _next_index--;
     native_register_interrupt(SIGIO, _async_io_isr);
 
     _fds[_next_index] = (struct pollfd){ 0 };
+    pollers[_next_index] = (async_read_t){ 0 };
 }
 
 void native_async_read_add_int_handler(int fd, void *arg, native_async_read_callback_t handler) {
@@ -131,15 +216,91 @@ void native_async_read_add_int_handler(int fd, void *arg, native_async_read_call
     }
 
     _add_handler(fd, arg, handler);
+    pollers[_next_index].interrupt = true;
 
+#ifdef __linux__
+    _reactor_start();
+    if (_reactor_arm(fd, EPOLL_CTL_ADD) == 0) {
+        pollers[_next_index].child_pid = _reactor_pid;
+    }
+    else if (errno == EPERM) {
+        /* regular file (e.g. stdin redirected from a file) */
+        _reactor_kick();
+    }
+    else {
+        err(EXIT_FAILURE, "native_async_read_add_int_handler(): epoll_ctl");
+    }
+#else
     _sigio_child(_next_index);
+#endif
     _next_index++;
 }
 
+#ifdef __linux__
+static void _reactor_start(void)
+{
+    if (_reactor_pid) {
+        return;
+    }
+
+    if ((_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_create1");
+    }
+    if (pipe2(_kick_fd, O_CLOEXEC | O_NONBLOCK) == -1) {
+        err(EXIT_FAILURE, "native_async_read: pipe2");
+    }
+
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = _kick_fd[0] };
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _kick_fd[0], &ev) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_ctl");
+    }
+
+    pid_t parent = _native_pid;
+    pid_t child;
+    if ((child = real_fork()) == -1) {
+        err(EXIT_FAILURE, "native_async_read: fork");
+    }
+    if (child > 0) {
+        _reactor_pid = child;
+
+        /* return in parent process */
+        return;
+    }
+
+    /* don't outlive the RIOT process */
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+    if (getppid() != parent) {
+        _exit(EXIT_SUCCESS);
+    }
+
+    /* Each file descriptor is registered with EPOLLONESHOT, so it does not
+     * report again until native_async_read_continue() re-arms it. All events
+     * returned by one call are signalled with a single SIGIO, the handler in
+     * the RIOT process polls all descriptors anyway. */
+    while (1) {
+        struct epoll_event evs[ASYNC_READ_NUMOF + 1];
+        int res = epoll_wait(_epoll_fd, evs, ARRAY_SIZE(evs), -1);
+
+        for (int i = 0; i < res; i++) {
+            if (evs[i].data.fd == _kick_fd[0]) {
+                char buf[16];
+                while (real_read(_kick_fd[0], buf, sizeof(buf)) > 0) {}
+            }
+        }
+        if (res > 0) {
+            kill(parent, SIGIO);
+        }
+        else if ((res == -1) && (errno != EINTR)) {
+            kill(parent, SIGKILL);
+            err(EXIT_FAILURE, "native_async_read: epoll_wait");
+        }
+    }
+}
+#else
 static void _sigio_child(int index)
 {
     struct pollfd fds = _fds[index];
-    async_read_t *poll = &pollers[_next_index];
+    async_read_t *poll = &pollers[index];
     pid_t parent = _native_pid;
     pid_t child;
     if ((child = real_fork()) == -1) {
@@ -179,3 +340,4 @@ static void _sigio_child(int index)
         sigwait(&sigmask, &sig);
     }
 }
+#endif
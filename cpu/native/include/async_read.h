@@ -16,6 +16,7 @@
  * @author Takuo Yonezawa <Yonezawa-T2@mail.dnp.co.jp>
  */
 
+#include <stdbool.h>
 #include <sys/types.h>
 #include <poll.h>
 
@@ -40,6 +41,8 @@ typedef void (*native_async_read_callback_t)(int fd, void *arg);
  */
 typedef struct {
     pid_t child_pid;                    /**< PID of the interrupt listener */
+    bool interrupt;                     /**< fd is watched by the interrupt
+                                         *   listener instead of `O_ASYNC` */
     native_async_read_callback_t cb;    /**< Interrupt callback function */
     void *arg;                          /**< Argument ptr for the callback */
     struct pollfd *fd;                  /**< sysfs gpio fd */
@@ -88,6 +91,12 @@ void native_async_read_remove_handler(int fd);
 /**
  * @brief   start monitoring of file descriptor as interrupt
  *
+ * Use this for file descriptors that do not support `O_ASYNC` or must not be
+ * modified (e.g. stdin). On Linux, all such file descriptors are watched by a
+ * single helper process using epoll, elsewhere one helper process is forked
+ * per file descriptor. Call @ref native_async_read_continue after handling
+ * an event to get notified of the next one.
+ *
  * @param[in] fd       The file descriptor to monitor
  * @param[in] arg      Pointer to be passed as arguments to the callback
  * @param[in] handler  The callback function to be called when the file
@@ -53,6 +53,32 @@ __attribute__((always_inline)) static inline uintptr_t cpu_get_caller_pc(void)
 }
 /** @} */
 
+/* MARK: - Images */
+/**
+ * @name    Firmware images
+ *
+ * native does not execute from its flash emulation, so there is no image to
+ * boot. These only allow building `riotboot_slot`, e.g. to test
+ * `riotboot_flashwrite` on the flash emulation.
+ * @{
+ */
+/**
+ * @brief   Gets the start address of the running image, always 0
+ */
+static inline uint32_t cpu_get_image_baseaddr(void)
+{
+    return 0;
+}
+
+/**
+ * @brief   Does nothing, booting another image is not supported
+ */
+static inline void cpu_jump_to_image(uint32_t image_address)
+{
+    (void)image_address;
+}
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
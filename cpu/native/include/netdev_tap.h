@@ -25,6 +25,7 @@ extern "C" {
 #include <stdbool.h>
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #include "net/if.h"
@@ -34,6 +35,17 @@ extern "C" {
  * @name Low-level ethernet driver for native tap interfaces
  * @{
  */
+/**
+ * @brief Maximum number of frames read from the TAP per signal
+ *
+ * On every RX signal all pending frames (up to this number) are read into a
+ * ring of frame buffers and reported one after the other, before the driver
+ * waits for the next signal.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH
+#  define CONFIG_NETDEV_TAP_RX_BATCH  (8U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +56,13 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+    struct {
+        /** frames read from the TAP */
+        uint8_t buf[CONFIG_NETDEV_TAP_RX_BATCH][ETHERNET_FRAME_LEN];
+        uint16_t len[CONFIG_NETDEV_TAP_RX_BATCH];   /**< frame lengths */
+        uint8_t head;                   /**< index of the oldest frame */
+        uint8_t numof;                  /**< number of frames in buf */
+    } rx;                               /**< RX ring */
 } netdev_tap_t;
 
 /**
@@ -84,6 +84,19 @@ typedef enum {
     ZEPDEV_STATE_TX,        /**< ZEP is currently sending a frame */
 } zepdev_state_t;
 
+/**
+ * @brief   ZEP device socket statistics
+ *
+ * Dividing the number of frames by the number of calls gives the frames
+ * handled per system call.
+ */
+typedef struct {
+    uint32_t tx_frames;     /**< frames sent */
+    uint32_t tx_calls;      /**< send system calls */
+    uint32_t rx_frames;     /**< frames passed to the upper layer */
+    uint32_t rx_calls;      /**< receive system calls */
+} socket_zep_stats_t;
+
 /**
  * @brief   ZEP device state
  */
@@ -101,8 +114,11 @@ typedef struct {
     uint8_t rcv_buf[sizeof(zep_v2_data_hdr_t) + IEEE802154_FRAME_LEN_MAX];
     /**
      * @brief   Send buffer
+     *
+     * Holds the PSDU including the FCS, the ZEP header is prepended when the
+     * frame is sent.
      */
-    uint8_t snd_buf[sizeof(zep_v2_data_hdr_t) + IEEE802154_FRAME_LEN_MAX];
+    uint8_t snd_buf[IEEE802154_FRAME_LEN_MAX];
     uint8_t snd_len;                /**< bytes to send */
     uint8_t rcv_len;                /**< bytes received */
     uint16_t pan_id;                /**< PAN ID of the ZEP network */
@@ -118,6 +134,7 @@ typedef struct {
     ieee802154_filter_mode_t filter_mode;   /**< frame filter mode */
     zepdev_state_t state;                   /**< device state machine */
     bool send_hello;                        /**< send HELLO packet on connect */
+    socket_zep_stats_t stats;               /**< socket statistics */
 } socket_zep_t;
 
 /**
@@ -93,16 +93,33 @@ static inline int _get_wired(netdev_t *netdev)
     return dev->wired;
 }
 
+static void _rx_fill(netdev_tap_t *dev);
+static void _continue_reading(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    if (!netdev->event_callback) {
 #if DEVELHELP
-    else {
         puts("netdev_tap: _isr(): no event_callback set.");
-    }
 #endif
+        return;
+    }
+
+    /* drain everything pending with one signal */
+    _rx_fill(dev);
+    while (dev->rx.numof) {
+        unsigned numof = dev->rx.numof;
+
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        if (dev->rx.numof == numof) {
+            /* upper layer did not take the frame, try again later */
+            break;
+        }
+    }
+
+    _continue_reading(dev);
 }
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
@@ -186,13 +203,13 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
@@ -209,7 +226,8 @@ static void _continue_reading(netdev_tap_t *dev)
 
     _native_pending_syscalls_up(); /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if ((dev->rx.numof > 0) ||
+        (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1)) {
         int sig = SIGIO;
         extern int _signal_pipe_fd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -225,73 +243,94 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_pending_syscalls_down();
 }
 
-static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+static bool _accept_frame(netdev_tap_t *dev, const uint8_t *frame)
 {
-    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
-    (void)info;
-
-    if (!buf) {
-        if (len > 0) {
-            /* no memory available in pktbuf, discarding the frame */
-            DEBUG("netdev_tap: discarding the frame\n");
+    const ethernet_hdr_t *hdr = (const ethernet_hdr_t *)frame;
+
+    if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
+        !_is_addr_broadcast(hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
 
-            /* repeating `real_read` for small size on tap device results in
-             * freeze for some reason. Using a large buffer for now. */
-            /*
-            uint8_t buf[4];
-            while (real_read(dev->tap_fd, buf, sizeof(buf)) > 0) {
-            }
-            */
+    return true;
+}
 
-            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
+static void _rx_fill(netdev_tap_t *dev)
+{
+    while (dev->rx.numof < CONFIG_NETDEV_TAP_RX_BATCH) {
+        unsigned idx = (dev->rx.head + dev->rx.numof) % CONFIG_NETDEV_TAP_RX_BATCH;
+        uint8_t *frame = dev->rx.buf[idx];
 
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
+        int nread = real_read(dev->tap_fd, frame, ETHERNET_FRAME_LEN);
+        DEBUG("netdev_tap: read %d bytes\n", nread);
 
-            _continue_reading(dev);
+        if (nread == -1) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            err(EXIT_FAILURE, "netdev_tap: read");
+        }
+        else if (nread == 0) {
+            DEBUG("_native_handle_tap_input: ignoring null-event\n");
+            break;
+        }
+        else if (nread < 0) {
+            errx(EXIT_FAILURE, "internal error _rx_event");
         }
 
-        /* no way of figuring out packet size without racey buffering,
-         * so we return the maximum possible size */
-        return ETHERNET_FRAME_LEN;
+        if ((nread < (int)sizeof(ethernet_hdr_t)) || !_accept_frame(dev, frame)) {
+            continue;
+        }
+        dev->rx.len[idx] = nread;
+        dev->rx.numof++;
     }
+}
 
-    int nread = real_read(dev->tap_fd, buf, len);
-    DEBUG("netdev_tap: read %d bytes\n", nread);
-
-    if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+static void _rx_pop(netdev_tap_t *dev)
+{
+    dev->rx.head = (dev->rx.head + 1) % CONFIG_NETDEV_TAP_RX_BATCH;
+    dev->rx.numof--;
+}
 
-            native_async_read_continue(dev->tap_fd);
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    (void)info;
 
-            return 0;
+    if (dev->rx.numof == 0) {
+        _rx_fill(dev);
+        if (dev->rx.numof == 0) {
+            return buf ? -1 : 0;
         }
+    }
 
-        _continue_reading(dev);
+    unsigned head = dev->rx.head;
+    size_t size = dev->rx.len[head];
 
-        return nread;
-    }
-    else if (nread == -1) {
-        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-        }
-        else {
-            err(EXIT_FAILURE, "netdev_tap: read");
+    if (!buf) {
+        if (len > 0) {
+            /* no memory available in pktbuf, discarding the frame */
+            DEBUG("netdev_tap: discarding the frame\n");
+            _rx_pop(dev);
         }
+        return size;
     }
-    else if (nread == 0) {
-        DEBUG("_native_handle_tap_input: ignoring null-event\n");
-    }
-    else {
-        errx(EXIT_FAILURE, "internal error _rx_event");
+
+    if (len < size) {
+        DEBUG("netdev_tap: buffer too small, discarding the frame\n");
+        _rx_pop(dev);
+        return -ENOBUFS;
     }
 
-    return -1;
+    memcpy(buf, dev->rx.buf[head], size);
+    _rx_pop(dev);
+
+    return size;
 }
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
@@ -349,6 +388,8 @@ static int _init(netdev_t *netdev)
 # endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->rx.head = 0;
+    dev->rx.numof = 0;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
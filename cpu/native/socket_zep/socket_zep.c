@@ -20,10 +20,12 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 
 #include "async_read.h"
 #include "byteorder.h"
 #include "checksum/crc16_ccitt.h"
+#include "container.h"
 #include "native_internal.h"
 
 #include "net/ieee802154/radio.h"
@@ -249,8 +251,13 @@ static void _send_zep_hello(socket_zep_t *dev)
         };
 
         /* append HW addr */
-        real_send(dev->sock_fd, &hdr, sizeof(hdr), MSG_MORE);
-        real_send(dev->sock_fd, dev->addr_long, sizeof(dev->addr_long), 0);
+        struct iovec iov[] = {
+            { .iov_base = &hdr, .iov_len = sizeof(hdr) },
+            { .iov_base = dev->addr_long, .iov_len = sizeof(dev->addr_long) },
+        };
+
+        real_writev(dev->sock_fd, iov, ARRAY_SIZE(iov));
+        dev->stats.tx_calls++;
     }
 }
 
@@ -258,55 +265,50 @@ static void _send_frame(void *arg)
 {
     ieee802154_dev_t *dev = arg;
     socket_zep_t *zepdev = dev->priv;
+    zep_v2_data_hdr_t hdr;
 
     assert(zepdev->state == ZEPDEV_STATE_TX);
 
-    int res = real_write(zepdev->sock_fd, zepdev->snd_buf, zepdev->snd_len);
+    /* prepend the header to the frame buffer, timestamped when sent */
+    struct iovec iov[] = {
+        { .iov_base = &hdr,
+          .iov_len = _zep_hdr_fill(zepdev, (void *)&hdr, zepdev->snd_len) },
+        { .iov_base = zepdev->snd_buf, .iov_len = zepdev->snd_len },
+    };
+
+    int res = real_writev(zepdev->sock_fd, iov, ARRAY_SIZE(iov));
     DEBUG("socket_zep::send_frame: wrote %d bytes\n", res);
+    (void)res;
 
+    zepdev->stats.tx_frames++;
+    zepdev->stats.tx_calls++;
     zepdev->state = ZEPDEV_STATE_IDLE;
     dev->cb(dev, IEEE802154_RADIO_CONFIRM_TX_DONE);
 }
 
-static void _socket_isr(int fd, void *arg)
+static bool _frame_is_valid(socket_zep_t *zepdev, int len)
 {
-    ieee802154_dev_t *dev = arg;
-    socket_zep_t *zepdev = dev->priv;
-    int res;
-
-    if (zepdev->state != ZEPDEV_STATE_RX_ON) {
-        res = real_recv(zepdev->sock_fd, &res, sizeof(res), MSG_TRUNC);
-        DEBUG("socket_zep::_socket_isr: discard frame (%d bytes, state %u)\n", res, zepdev->state);
-        return;
-    }
-
-    zepdev->rcv_len = 0;
-    zepdev->state = ZEPDEV_STATE_RX_RECV;
-
-    res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, sizeof(zepdev->rcv_buf), 0);
-    DEBUG("socket_zep::_socket_isr: %d bytes on %d\n", res, fd);
-
-    if (res < (int)sizeof(zep_v2_data_hdr_t)) {
+    if (len < (int)sizeof(zep_v2_data_hdr_t)) {
         DEBUG("socket_zep::_socket_isr: frame is shorter than the header, %d < %zu\n",
-              res, sizeof(zep_v2_data_hdr_t));
-        goto out;
+              len, sizeof(zep_v2_data_hdr_t));
+        return false;
     }
 
     zep_hdr_t *tmp = (zep_hdr_t *)zepdev->rcv_buf;
 
     if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
         DEBUG("socket_zep::read: invalid ZEP header\n");
-        goto out;
+        return false;
     }
 
     if (tmp->version != 2) {
         DEBUG("socket_zep::read: unsupported ZEP version %u\n", tmp->version);
-        goto out;
+        return false;
     }
 
     if (((zep_v2_ack_hdr_t *)tmp)->type != ZEP_V2_TYPE_DATA) {
         DEBUG("socket_zep::read: unknown type %u\n", ((zep_v2_ack_hdr_t *)tmp)->type);
-        goto out;
+        return false;
     }
 
     /* we received a valid ZEP frame */
@@ -314,21 +316,51 @@ static void _socket_isr(int fd, void *arg)
 
     if (zep->chan != zepdev->chan) {
         DEBUG("socket_zep::read: wrong channel %d but expected %d\n", zep->chan, zepdev->chan);
-        goto out;
+        return false;
     }
 
     if (_dst_not_me(zepdev, zep + 1)) {
         DEBUG("socket_zep::read: dst not me\n");
-        goto out;
+        return false;
     }
 
-    zepdev->rcv_len = res;
-    dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_START);
+    return true;
+}
 
-    dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_DONE);
+static void _socket_isr(int fd, void *arg)
+{
+    ieee802154_dev_t *dev = arg;
+    socket_zep_t *zepdev = dev->priv;
+    int res;
+
+    if (zepdev->state != ZEPDEV_STATE_RX_ON) {
+        res = real_recv(zepdev->sock_fd, &res, sizeof(res), MSG_TRUNC);
+        zepdev->stats.rx_calls++;
+        DEBUG("socket_zep::_socket_isr: discard frame (%d bytes, state %u)\n", res, zepdev->state);
+        return;
+    }
+
+    zepdev->rcv_len = 0;
+    zepdev->state = ZEPDEV_STATE_RX_RECV;
+
+    /* Frames not meant for us are dropped right here until a valid one is
+     * found or the socket is drained, instead of going through the signal
+     * handler again for each of them. */
+    while ((res = real_recv(zepdev->sock_fd, zepdev->rcv_buf,
+                            sizeof(zepdev->rcv_buf), MSG_DONTWAIT)) >= 0) {
+        DEBUG("socket_zep::_socket_isr: %d bytes on %d\n", res, fd);
+        zepdev->stats.rx_calls++;
+
+        if (_frame_is_valid(zepdev, res)) {
+            zepdev->rcv_len = res;
+            zepdev->stats.rx_frames++;
+            dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_START);
+            dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_DONE);
+            return;
+        }
+    }
+    zepdev->stats.rx_calls++;
 
-    return;
-out:
     _continue_reading(zepdev);
 }
 
@@ -475,31 +507,26 @@ static int _get_frame_filter_mode(ieee802154_dev_t *dev, ieee802154_filter_mode_
 static int _write(ieee802154_dev_t *dev, const iolist_t *iolist)
 {
     socket_zep_t *zepdev = dev->priv;
-    unsigned n = iolist_count(iolist);
     size_t bytes = iolist_size(iolist) + sizeof(uint16_t); /* FCS field */
     uint8_t *out = zepdev->snd_buf;
     uint16_t chksum = 0;
 
     DEBUG("socket_zep::write(%zu bytes)\n", bytes);
 
-    out += _zep_hdr_fill(zepdev, (void *)out, bytes);
-
     /* make sure we are not overflowing the TX buffer */
-    if (out + bytes > zepdev->snd_buf + sizeof(zepdev->snd_buf)) {
+    if (bytes > sizeof(zepdev->snd_buf)) {
         return -ENOBUFS;
     }
 
-    for (unsigned i = 0; i < n; i++) {
+    for (; iolist; iolist = iolist->iol_next) {
         memcpy(out, iolist->iol_base, iolist->iol_len);
         chksum = crc16_ccitt_false_update(chksum, iolist->iol_base, iolist->iol_len);
         out += iolist->iol_len;
-        iolist = iolist->iol_next;
     }
     chksum = byteorder_htols(chksum).u16;
     memcpy(out, &chksum, sizeof(chksum));
-    out += sizeof(chksum);
 
-    zepdev->snd_len = out - zepdev->snd_buf;
+    zepdev->snd_len = bytes;
 
     return 0;
 }
@@ -511,7 +538,7 @@ static int _request_transmit(ieee802154_dev_t *dev)
     zepdev->state = ZEPDEV_STATE_TX;
 
     /* 8 bit are mapped to 2 symbols */
-    unsigned time_tx = 2 * (zepdev->snd_len - sizeof(zep_v2_data_hdr_t)) * IEEE802154_SYMBOL_TIME_US;
+    unsigned time_tx = 2 * zepdev->snd_len * IEEE802154_SYMBOL_TIME_US;
     DEBUG("socket_zep::request_transmit(%u bytes, %u µs)\n", zepdev->snd_len, time_tx);
 
     dev->cb(dev, IEEE802154_RADIO_INDICATION_TX_START);
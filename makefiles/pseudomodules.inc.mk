@@ -59,7 +59,11 @@ PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpp
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
+PSEUDOMODULES += crc16_slice4
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_hw
+PSEUDOMODULES += crc32_slice4
+PSEUDOMODULES += crc32_slice8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -84,6 +88,13 @@ PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+## @addtogroup net_gcoap
+## @{
+## Enable hash indexes for matching messages in @ref net_gcoap
+PSEUDOMODULES += gcoap_index
+## Handle requests in a pool of worker threads in @ref net_gcoap
+PSEUDOMODULES += gcoap_workers
+## @}
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -121,6 +132,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
 PSEUDOMODULES += gnrc_ipv6_nib_dns
 PSEUDOMODULES += gnrc_ipv6_nib_dyn_lladdr
+PSEUDOMODULES += gnrc_ipv6_nib_offl_trie
 PSEUDOMODULES += gnrc_ipv6_nib_rio
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
@@ -135,6 +147,23 @@ PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
 
+## @defgroup pseudomodule_gnrc_pktbuf_static_slab gnrc_pktbuf_static_slab
+## @brief Serve small allocations of `gnrc_pktbuf_static` from size classes
+##
+## Packet snip descriptors and short headers are taken from
+## @ref CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF fixed-size objects per size class
+## carved from the packet buffer, so they neither fragment the arena nor need
+## a first-fit search.
+PSEUDOMODULES += gnrc_pktbuf_static_slab
+
+## @defgroup pseudomodule_gnrc_netreg_hash gnrc_netreg_hash
+## @brief Keep @ref net_gnrc_netreg entries in hash buckets
+##
+## Entries are looked up in one of @ref CONFIG_GNRC_NETREG_HASH_BUCKETS lists
+## selected by their type and demultiplexing context instead of searching all
+## entries of the type.
+PSEUDOMODULES += gnrc_netreg_hash
+
 
 ## @addtogroup 	net_gnrc_nettype
 ## @{
@@ -244,6 +273,31 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @addtogroup net_gnrc_tcp_congure
+## @{
+##
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_abe gnrc_tcp_congure_abe: TCP Reno with ABE
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm with ABE](@ref sys_congure_abe)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_abe
+## @}
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @defgroup net_gnrc_tcp_congure_quic gnrc_tcp_congure_quic: QUIC CC
+## @brief  Congestion control for GNRC TCP using the [congestion control algorithm of QUIC](@ref sys_congure_quic)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_quic
+## @}
+## @defgroup net_gnrc_tcp_pacing gnrc_tcp_pacing: Pacing
+## @brief  Spread the data segments of GNRC TCP over the round trip time
+## @{
+PSEUDOMODULES += gnrc_tcp_pacing
+## @}
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -291,6 +345,8 @@ PSEUDOMODULES += pmp_noexec_ram
 
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
+## Derive @ref net_nanocoap_cache keys with SipHash under a per-boot random key
+PSEUDOMODULES += nanocoap_cache_siphash
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
@@ -534,6 +590,15 @@ PSEUDOMODULES += vfs_auto_format
 ## some boards if the @ref pseudomodule_vfs_default module is active.
 PSEUDOMODULES += vfs_auto_mount
 
+## @defgroup pseudomodule_vfs_readahead vfs_readahead
+## @brief Serve small reads of read-only files from a per file buffer
+##
+## Every open file gets a buffer of @ref CONFIG_VFS_READAHEAD_SIZE bytes. Files
+## opened with `O_RDONLY` on mount points with a non-zero
+## @ref vfs_mount_t::readahead are read from the file system driver in chunks
+## of that size, so sequential small reads and @ref vfs_readline only hit RAM.
+PSEUDOMODULES += vfs_readahead
+
 ## @defgroup pseudomodule_vfs_default vfs_default
 ## @brief Enable default assignments of a board's devices to VFS mount points
 ##
@@ -572,6 +637,12 @@ PSEUDOMODULES += ztimer64_%
 ## configuration header board.h. These can be found out by running tests/sys/ztimer_overhead
 PSEUDOMODULES += ztimer_auto_adjust
 
+## @defgroup pseudomodule_ztimer_heap ztimer_heap
+## @brief Allow ztimer clocks to keep their timers in a pairing heap
+##
+## See @ref sys_ztimer_heap for details.
+PSEUDOMODULES += ztimer_heap
+
 # core_lib is not a submodule
 NO_PSEUDOMODULES += core_lib
 
@@ -64,6 +64,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN            1060
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_LATENCY
+/**
+ * @brief   scheduler latency histogram priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_LATENCY                1065
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_DUMMY_THREAD
 /**
  * @brief   dummy thread priority
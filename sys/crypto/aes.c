@@ -32,13 +32,30 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include "architecture.h"
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
 #include "kernel_defines.h"
 
+/* AES-NI is detected at runtime on native, all other CPUs use the tables */
+#if defined(CPU_NATIVE) && (defined(__x86_64__) || defined(__i386__)) && \
+    defined(__GNUC__) && !defined(AES_ASM)
+#  include <immintrin.h>
+#  define AES_NI 1
+#else
+#  define AES_NI 0
+#endif
+
+/**
+ * @brief Number of counter blocks encrypted at once by aes_ctr_blocks()
+ */
+#define AES_CTR_CHUNK   4
+
 #if !IS_USED(MODULE_CRYPTO_AES_128) && !IS_USED(MODULE_CRYPTO_AES_192) && \
     !IS_USED(MODULE_CRYPTO_AES_256)
     #error "sys/crypto/aes: No aes module used."
@@ -77,7 +94,10 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
+    aes_decrypt_blocks,
+    aes_ctr_blocks
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
@@ -1062,23 +1082,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _aes_encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                               uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1327,28 +1336,15 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
 /*
- * Decrypt a single block
+ * Decrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+static void _aes_decrypt_block(const aes_key_t *key, const uint8_t *cipherBlock,
+                               uint8_t *plainBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1589,7 +1585,224 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
+}
+
+#if AES_NI
+/*
+ * The AES-NI instructions take the round keys in memory byte order, the
+ * tables above use big endian words. The decryption key schedule is already
+ * in the form aesdec expects (reversed, InvMixColumns applied).
+ */
+static bool _aesni_usable(void)
+{
+    return __builtin_cpu_supports("aes");
+}
+
+static void _aesni_convert_key(aes_key_t *key)
+{
+    for (int i = 0; i < 4 * (key->rounds + 1); i++) {
+        u32 w = key->rd_key[i];
+        PUTU32((u8 *)&key->rd_key[i], w);
+    }
+}
+
+#define AESNI_ROUND_KEY(key, r) \
+    _mm_loadu_si128((const __m128i *)(const void *)&(key)->rd_key[4 * (r)])
+
+__attribute__((target("aes,sse2")))
+static void _aesni_encrypt_blocks(const aes_key_t *key, const uint8_t *in,
+                                  uint8_t *out, size_t num)
+{
+    const int nr = key->rounds;
+
+    for (; num >= 4; num -= 4, in += 64, out += 64) {
+        __m128i rk = AESNI_ROUND_KEY(key, 0);
+        __m128i b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in +  0)), rk);
+        __m128i b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 16)), rk);
+        __m128i b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 32)), rk);
+        __m128i b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 48)), rk);
+
+        for (int r = 1; r < nr; r++) {
+            rk = AESNI_ROUND_KEY(key, r);
+            b0 = _mm_aesenc_si128(b0, rk);
+            b1 = _mm_aesenc_si128(b1, rk);
+            b2 = _mm_aesenc_si128(b2, rk);
+            b3 = _mm_aesenc_si128(b3, rk);
+        }
+        rk = AESNI_ROUND_KEY(key, nr);
+        _mm_storeu_si128((__m128i *)(out +  0), _mm_aesenclast_si128(b0, rk));
+        _mm_storeu_si128((__m128i *)(out + 16), _mm_aesenclast_si128(b1, rk));
+        _mm_storeu_si128((__m128i *)(out + 32), _mm_aesenclast_si128(b2, rk));
+        _mm_storeu_si128((__m128i *)(out + 48), _mm_aesenclast_si128(b3, rk));
+    }
+    for (; num > 0; num--, in += 16, out += 16) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in),
+                                  AESNI_ROUND_KEY(key, 0));
+
+        for (int r = 1; r < nr; r++) {
+            b = _mm_aesenc_si128(b, AESNI_ROUND_KEY(key, r));
+        }
+        _mm_storeu_si128((__m128i *)out,
+                         _mm_aesenclast_si128(b, AESNI_ROUND_KEY(key, nr)));
+    }
+}
+
+__attribute__((target("aes,sse2")))
+static void _aesni_decrypt_blocks(const aes_key_t *key, const uint8_t *in,
+                                  uint8_t *out, size_t num)
+{
+    const int nr = key->rounds;
+
+    for (; num >= 4; num -= 4, in += 64, out += 64) {
+        __m128i rk = AESNI_ROUND_KEY(key, 0);
+        __m128i b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in +  0)), rk);
+        __m128i b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 16)), rk);
+        __m128i b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 32)), rk);
+        __m128i b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + 48)), rk);
+
+        for (int r = 1; r < nr; r++) {
+            rk = AESNI_ROUND_KEY(key, r);
+            b0 = _mm_aesdec_si128(b0, rk);
+            b1 = _mm_aesdec_si128(b1, rk);
+            b2 = _mm_aesdec_si128(b2, rk);
+            b3 = _mm_aesdec_si128(b3, rk);
+        }
+        rk = AESNI_ROUND_KEY(key, nr);
+        _mm_storeu_si128((__m128i *)(out +  0), _mm_aesdeclast_si128(b0, rk));
+        _mm_storeu_si128((__m128i *)(out + 16), _mm_aesdeclast_si128(b1, rk));
+        _mm_storeu_si128((__m128i *)(out + 32), _mm_aesdeclast_si128(b2, rk));
+        _mm_storeu_si128((__m128i *)(out + 48), _mm_aesdeclast_si128(b3, rk));
+    }
+    for (; num > 0; num--, in += 16, out += 16) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in),
+                                  AESNI_ROUND_KEY(key, 0));
+
+        for (int r = 1; r < nr; r++) {
+            b = _mm_aesdec_si128(b, AESNI_ROUND_KEY(key, r));
+        }
+        _mm_storeu_si128((__m128i *)out,
+                         _mm_aesdeclast_si128(b, AESNI_ROUND_KEY(key, nr)));
+    }
+}
+#endif /* AES_NI */
+
+/*
+ * Expand the key once for a whole multi-block operation
+ */
+static int _aes_expand_key(const cipher_context_t *context, aes_key_t *key,
+                           bool decrypt)
+{
+    int res;
+
+    if (decrypt) {
+        res = aes_set_decrypt_key(context->context, AES_KEY_SIZE(context) * 8,
+                                  key);
+    }
+    else {
+        res = aes_set_encrypt_key(context->context, AES_KEY_SIZE(context) * 8,
+                                  key);
+    }
+#if AES_NI
+    if ((res == 0) && _aesni_usable()) {
+        _aesni_convert_key(key);
+    }
+#endif
+    return res;
+}
+
+static void _aes_encrypt_blocks(const aes_key_t *key, const uint8_t *in,
+                                uint8_t *out, size_t num)
+{
+#if AES_NI
+    if (_aesni_usable()) {
+        _aesni_encrypt_blocks(key, in, out, num);
+        return;
+    }
+#endif
+    for (; num > 0; num--, in += AES_BLOCK_SIZE, out += AES_BLOCK_SIZE) {
+        _aes_encrypt_block(key, in, out);
+    }
+}
+
+static void _aes_decrypt_blocks(const aes_key_t *key, const uint8_t *in,
+                                uint8_t *out, size_t num)
+{
+#if AES_NI
+    if (_aesni_usable()) {
+        _aesni_decrypt_blocks(key, in, out, num);
+        return;
+    }
+#endif
+    for (; num > 0; num--, in += AES_BLOCK_SIZE, out += AES_BLOCK_SIZE) {
+        _aes_decrypt_block(key, in, out);
+    }
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t num)
+{
+    aes_key_t key;
+    int res = _aes_expand_key(context, &key, false);
+
+    if (res < 0) {
+        return res;
+    }
+    _aes_encrypt_blocks(&key, plain, cipher, num);
     return 1;
 }
 
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *cipher,
+                       uint8_t *plain, size_t num)
+{
+    aes_key_t key;
+    int res = _aes_expand_key(context, &key, true);
+
+    if (res < 0) {
+        return res;
+    }
+    _aes_decrypt_blocks(&key, cipher, plain, num);
+    return 1;
+}
+
+int aes_ctr_blocks(const cipher_context_t *context, uint8_t *ctr,
+                   uint8_t ctr_len, const uint8_t *in, uint8_t *out,
+                   size_t num)
+{
+    aes_key_t key;
+    /* word aligned, so that crypto_xor() works word-wise */
+    uword_t stream_words[AES_CTR_CHUNK * AES_BLOCK_SIZE / sizeof(uword_t)];
+    uint8_t *stream = (uint8_t *)stream_words;
+    int res = _aes_expand_key(context, &key, false);
+
+    if (res < 0) {
+        return res;
+    }
+    while (num > 0) {
+        size_t n = (num < AES_CTR_CHUNK) ? num : AES_CTR_CHUNK;
+
+        for (size_t i = 0; i < n; i++) {
+            memcpy(&stream[i * AES_BLOCK_SIZE], ctr, AES_BLOCK_SIZE);
+            crypto_block_inc_ctr(ctr, ctr_len);
+        }
+        _aes_encrypt_blocks(&key, stream, stream, n);
+        crypto_xor(out, in, stream, n * AES_BLOCK_SIZE);
+        in += n * AES_BLOCK_SIZE;
+        out += n * AES_BLOCK_SIZE;
+        num -= n;
+    }
+    return 1;
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    return aes_decrypt_blocks(context, cipher_block, plain_block, 1);
+}
+
 #endif /* AES_ASM */
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
@@ -43,72 +44,136 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+/* Size of a ChaCha20 key stream block in bytes */
+#define CHACHA20_BLOCK_BYTES    (64U)
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+static void _init_state(uint32_t *state, const uint8_t *key,
+                        const uint8_t *nonce, uint32_t blk)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        state[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        state[i+4] = unaligned_get_u32(key + 4*i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    state[12] = blk;
+    state[13] = unaligned_get_u32(nonce);
+    state[14] = unaligned_get_u32(nonce+4);
+    state[15] = unaligned_get_u32(nonce+8);
+}
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+static inline __m128i _rotl(__m128i v, int c)
+{
+    return _mm_or_si128(_mm_slli_epi32(v, c), _mm_srli_epi32(v, 32 - c));
+}
+
+/* Quarter rounds on all four columns of the state matrix at once */
+static inline void _rounds(__m128i *a, __m128i *b, __m128i *c, __m128i *d)
+{
+    *a = _mm_add_epi32(*a, *b);
+    *d = _rotl(_mm_xor_si128(*d, *a), 16);
+    *c = _mm_add_epi32(*c, *d);
+    *b = _rotl(_mm_xor_si128(*b, *c), 12);
+    *a = _mm_add_epi32(*a, *b);
+    *d = _rotl(_mm_xor_si128(*d, *a), 8);
+    *c = _mm_add_epi32(*c, *d);
+    *b = _rotl(_mm_xor_si128(*b, *c), 7);
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+/* Key stream block with one row of the state matrix per SSE2 register */
+static void _block(uint32_t *out, const uint32_t *state)
+{
+    const __m128i s0 = _mm_loadu_si128((const __m128i *)&state[0]);
+    const __m128i s1 = _mm_loadu_si128((const __m128i *)&state[4]);
+    const __m128i s2 = _mm_loadu_si128((const __m128i *)&state[8]);
+    const __m128i s3 = _mm_loadu_si128((const __m128i *)&state[12]);
+    __m128i a = s0, b = s1, c = s2, d = s3;
+
+    for (unsigned i = 0; i < 10; i++) {
+        _rounds(&a, &b, &c, &d);
+        /* rotate the rows, so that the diagonals become columns */
+        b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));
+        c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm_shuffle_epi32(d, _MM_SHUFFLE(2, 1, 0, 3));
+        _rounds(&a, &b, &c, &d);
+        b = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));
+        c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm_shuffle_epi32(d, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+    _mm_storeu_si128((__m128i *)&out[0], _mm_add_epi32(a, s0));
+    _mm_storeu_si128((__m128i *)&out[4], _mm_add_epi32(b, s1));
+    _mm_storeu_si128((__m128i *)&out[8], _mm_add_epi32(c, s2));
+    _mm_storeu_si128((__m128i *)&out[12], _mm_add_epi32(d, s3));
+}
+#else
+/* Single round */
+static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
+    *a += *b;
+    uint32_t tmp = *a ^ *d;
+    *d = (tmp << c) | (tmp >> (32 - c));
+}
+
+static void _block(uint32_t *out, const uint32_t *state)
+{
+    memcpy(out, state, CHACHA20_BLOCK_BYTES);
 
     /* perform rounds */
     for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
+        uint32_t *a = &out[((i                    ) & 3)          ];
+        uint32_t *b = &out[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
+        uint32_t *c = &out[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
+        uint32_t *d = &out[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
         _r(a, b, d, 16);
         _r(c, d, b, 12);
         _r(a, b, d, 8);
         _r(c, d, b, 7);
     }
     /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    for (unsigned i = 0; i < 16; i++) {
+        out[i] += state[i];
+    }
 }
+#endif
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out,
-                    size_t len, size_t counter)
+/* XOR up to one key stream block into the output, a word at a time */
+static void _xor_block(uint8_t *out, const uint8_t *in, const uint32_t *stream,
+                       size_t len)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
     size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i + counter);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
-        }
+
+    for (; pos + 4 <= len; pos += 4) {
+        uint32_t word = unaligned_get_u32(in + pos) ^ stream[pos / 4];
+        memcpy(out + pos, &word, sizeof(word));
     }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks + counter);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    for (; pos < len; pos++) {
+        out[pos] = in[pos] ^ ((const uint8_t *)stream)[pos];
+    }
+}
+
+static void _xcrypt(const uint8_t *key, const uint8_t *nonce,
+                    const uint8_t *in, uint8_t *out, size_t len,
+                    uint32_t counter)
+{
+    uint32_t state[16];
+    uint32_t stream[16];
+
+    _init_state(state, key, nonce, counter);
+    for (size_t pos = 0; pos < len; pos += CHACHA20_BLOCK_BYTES) {
+        size_t n = len - pos;
+
+        if (n > CHACHA20_BLOCK_BYTES) {
+            n = CHACHA20_BLOCK_BYTES;
         }
+        _block(stream, state);
+        _xor_block(out + pos, in + pos, stream, n);
+        state[12]++;
     }
+    crypto_secure_wipe(state, sizeof(state));
+    crypto_secure_wipe(stream, sizeof(stream));
 }
 
 static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
@@ -118,37 +183,59 @@ static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t l
     poly1305_update(pctx, padding, padlen);
 }
 
-/* Generate a poly1305 tag */
-static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *nonce,
-                             const uint8_t *cipher, size_t cipherlen,
-                             const uint8_t *aad, size_t aadlen)
+/* Encrypt or decrypt and authenticate the ciphertext in a single pass. The
+ * MAC is updated with each key stream block worth of ciphertext while it is
+ * still in the cache. */
+static void _aead(uint8_t *mac, const uint8_t *in, uint8_t *out, size_t len,
+                  const uint8_t *aad, size_t aadlen, const uint8_t *key,
+                  const uint8_t *nonce, bool encrypt)
 {
-    chacha20poly1305_ctx_t ctx;
-    /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
-    poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
+    uint32_t state[16];
+    uint32_t stream[16];
+    poly1305_ctx_t poly;
+
+    /* generate one time key from the first block */
+    _init_state(state, key, nonce, 0);
+    _block(stream, state);
+    poly1305_init(&poly, (uint8_t *)stream);
     /* Add aad */
-    _poly1305_padded(&ctx.poly, aad, aadlen);
-    /* Add ciphertext */
-    _poly1305_padded(&ctx.poly, cipher, cipherlen);
-    /* Add aad length */
-    const uint64_t lengths[2] = {aadlen, cipherlen};
-    poly1305_update(&ctx.poly, (uint8_t*)lengths, sizeof(lengths));
-    poly1305_finish(&ctx.poly, mac);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    _poly1305_padded(&poly, aad, aadlen);
+
+    for (size_t pos = 0; pos < len; pos += CHACHA20_BLOCK_BYTES) {
+        size_t n = len - pos;
+
+        if (n > CHACHA20_BLOCK_BYTES) {
+            n = CHACHA20_BLOCK_BYTES;
+        }
+        state[12]++;
+        _block(stream, state);
+        /* in and out may overlap, authenticate the ciphertext in order */
+        if (!encrypt) {
+            poly1305_update(&poly, in + pos, n);
+        }
+        _xor_block(out + pos, in + pos, stream, n);
+        if (encrypt) {
+            poly1305_update(&poly, out + pos, n);
+        }
+    }
+    poly1305_update(&poly, padding, (16 - len) & 0xF);
+
+    /* Add aad and ciphertext length */
+    const uint64_t lengths[2] = {aadlen, len};
+    poly1305_update(&poly, (uint8_t*)lengths, sizeof(lengths));
+    poly1305_finish(&poly, mac);
+
+    /* Wipe structures */
+    crypto_secure_wipe(state, sizeof(state));
+    crypto_secure_wipe(stream, sizeof(stream));
+    crypto_secure_wipe(&poly, sizeof(poly));
 }
 
 void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen, 1);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
-    /* Generate tag */
-    _poly1305_gentag(&cipher[msglen], key, nonce,
-                    cipher, msglen, aad, aadlen);
-    /* Wipe structures */
+    _aead(&cipher[msglen], msg, cipher, msglen, aad, aadlen, key, nonce, true);
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -158,14 +245,12 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
 {
     *msglen = cipherlen - CHACHA20POLY1305_TAG_BYTES;
     uint8_t mac[16];
-    _poly1305_gentag(mac, key, nonce, cipher,
-                     cipherlen - CHACHA20POLY1305_TAG_BYTES, aad, aadlen);
+    _aead(mac, cipher, msg, *msglen, aad, aadlen, key, nonce, false);
     if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+        /* do not leave unauthenticated plaintext behind */
+        crypto_secure_wipe(msg, *msglen);
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen, 1);
     return 1;
 }
 
@@ -173,6 +258,5 @@ void chacha20_encrypt_decrypt(const uint8_t *input, uint8_t *output,
                               const uint8_t *key, const uint8_t *nonce,
                               size_t inputlen)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, input, output, inputlen, 0);
+    _xcrypt(key, nonce, input, output, inputlen, 0);
 }
@@ -17,6 +17,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
 
 int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
                 uint8_t key_size)
@@ -37,6 +38,67 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
     return cipher->interface->decrypt(&cipher->context, input, output);
 }
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num)
+{
+    const cipher_interface_t *iface = cipher->interface;
+
+    if (iface->encrypt_blocks) {
+        return iface->encrypt_blocks(&cipher->context, input, output, num);
+    }
+    for (; num > 0; num--) {
+        int res = iface->encrypt(&cipher->context, input, output);
+        if (res != 1) {
+            return res;
+        }
+        input += iface->block_size;
+        output += iface->block_size;
+    }
+    return 1;
+}
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num)
+{
+    const cipher_interface_t *iface = cipher->interface;
+
+    if (iface->decrypt_blocks) {
+        return iface->decrypt_blocks(&cipher->context, input, output, num);
+    }
+    for (; num > 0; num--) {
+        int res = iface->decrypt(&cipher->context, input, output);
+        if (res != 1) {
+            return res;
+        }
+        input += iface->block_size;
+        output += iface->block_size;
+    }
+    return 1;
+}
+
+int cipher_ctr_blocks(const cipher_t *cipher, uint8_t *ctr, uint8_t ctr_len,
+                      const uint8_t *input, uint8_t *output, size_t num)
+{
+    const cipher_interface_t *iface = cipher->interface;
+    uint8_t stream_block[CIPHER_MAX_BLOCK_SIZE];
+
+    if (iface->ctr_blocks) {
+        return iface->ctr_blocks(&cipher->context, ctr, ctr_len, input, output,
+                                 num);
+    }
+    for (; num > 0; num--) {
+        int res = iface->encrypt(&cipher->context, ctr, stream_block);
+        if (res != 1) {
+            return res;
+        }
+        crypto_xor(output, input, stream_block, iface->block_size);
+        crypto_block_inc_ctr(ctr, ctr_len);
+        input += iface->block_size;
+        output += iface->block_size;
+    }
+    return 1;
+}
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
@@ -7,6 +7,9 @@
  * directory for more details.
  */
 
+#include <string.h>
+
+#include "architecture.h"
 #include "crypto/helper.h"
 
 void crypto_block_inc_ctr(uint8_t block[16], int L)
@@ -20,6 +23,34 @@ void crypto_block_inc_ctr(uint8_t block[16], int L)
     }
 }
 
+void crypto_xor(uint8_t *out, const uint8_t *a, const uint8_t *b, size_t len)
+{
+    if ((((uintptr_t)out | (uintptr_t)a | (uintptr_t)b) & (sizeof(uword_t) - 1)) == 0) {
+        /* memcpy() on known aligned pointers compiles to plain word accesses */
+        uint8_t *o = __builtin_assume_aligned(out, sizeof(uword_t));
+        const uint8_t *x = __builtin_assume_aligned(a, sizeof(uword_t));
+        const uint8_t *y = __builtin_assume_aligned(b, sizeof(uword_t));
+
+        for (; len >= sizeof(uword_t); len -= sizeof(uword_t)) {
+            uword_t wx, wy;
+
+            memcpy(&wx, x, sizeof(wx));
+            memcpy(&wy, y, sizeof(wy));
+            wx ^= wy;
+            memcpy(o, &wx, sizeof(wx));
+            o += sizeof(uword_t);
+            x += sizeof(uword_t);
+            y += sizeof(uword_t);
+        }
+        out = o;
+        a = x;
+        b = y;
+    }
+    while (len--) {
+        *out++ = *a++ ^ *b++;
+    }
+}
+
 int crypto_equals(const uint8_t *a, const uint8_t *b, size_t len)
 {
     uint8_t diff = 0;
@@ -19,8 +19,15 @@
  */
 
 #include <string.h>
+#include "architecture.h"
+#include "crypto/helper.h"
 #include "crypto/modes/cbc.h"
 
+/**
+ * @brief Number of blocks cipher_decrypt_cbc() decrypts at once in place
+ */
+#define CBC_DECRYPT_CHUNK   4
+
 int cipher_encrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
                        const uint8_t *input, size_t length, uint8_t *output)
 {
@@ -36,10 +43,7 @@ int cipher_encrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
     output_block_last = iv;
     do {
         /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        memcpy(input_block, input + offset, block_size);
-        for (int i = 0; i < block_size; ++i) {
-            input_block[i] ^= output_block_last[i];
-        }
+        crypto_xor(input_block, input + offset, output_block_last, block_size);
 
         if (cipher_encrypt(cipher, input_block, output + offset) != 1) {
             return CIPHER_ERR_ENC_FAILED;
@@ -56,31 +60,58 @@ int cipher_decrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
                        const uint8_t *input, size_t length, uint8_t *output)
 {
     size_t offset = 0;
-    const uint8_t *input_block, *input_block_last;
-    uint8_t block_size;
+    uint8_t block_size, chaining[CIPHER_MAX_BLOCK_SIZE];
+    uword_t input_words[CBC_DECRYPT_CHUNK * CIPHER_MAX_BLOCK_SIZE /
+                        sizeof(uword_t)];
+    uint8_t *input_chunk = (uint8_t *)input_words;
 
     block_size = cipher_get_block_size(cipher);
     if (length % block_size != 0) {
         return CIPHER_ERR_INVALID_LENGTH;
     }
+    if (length == 0) {
+        return 0;
+    }
 
-    input_block_last = iv;
-    do {
-        input_block = input + offset;
-        uint8_t *output_block = output + offset;
-
-        if (cipher_decrypt(cipher, input_block, output_block) != 1) {
+    /* Unlike encryption, decryption of all blocks is independent. If the
+     * ciphertext stays intact, all blocks are decrypted at once. */
+    if ((uintptr_t)output + length <= (uintptr_t)input ||
+        (uintptr_t)input + length <= (uintptr_t)output) {
+        if (cipher_decrypt_blocks(cipher, input, output,
+                                  length / block_size) != 1) {
             return CIPHER_ERR_DEC_FAILED;
         }
 
         /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (uint8_t i = 0; i < block_size; ++i) {
-            output_block[i] ^= input_block_last[i];
+        crypto_xor(output, output, iv, block_size);
+        crypto_xor(output + block_size, output + block_size, input,
+                   length - block_size);
+        return length;
+    }
+
+    /* Otherwise chunks of ciphertext are copied before they are overwritten */
+    memcpy(chaining, iv, block_size);
+    while (offset < length) {
+        size_t chunk_len = length - offset;
+        uint8_t *output_chunk = output + offset;
+
+        if (chunk_len > sizeof(input_words)) {
+            chunk_len = sizeof(input_words) - sizeof(input_words) % block_size;
         }
+        memcpy(input_chunk, input + offset, chunk_len);
 
-        input_block_last = input_block;
-        offset += block_size;
-    } while (offset < length);
+        if (cipher_decrypt_blocks(cipher, input_chunk, output_chunk,
+                                  chunk_len / block_size) != 1) {
+            return CIPHER_ERR_DEC_FAILED;
+        }
+
+        crypto_xor(output_chunk, output_chunk, chaining, block_size);
+        crypto_xor(output_chunk + block_size, output_chunk + block_size,
+                   input_chunk, chunk_len - block_size);
+        memcpy(chaining, input_chunk + chunk_len - block_size, block_size);
+
+        offset += chunk_len;
+    }
 
     return offset;
 }
@@ -55,9 +55,7 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
                                    block_size : length - offset;
 
         /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
-        }
+        crypto_xor(mac, mac, input + offset, block_size_input);
 
         if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
             return CIPHER_ERR_ENC_FAILED;
@@ -230,9 +228,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
     }
 
     /* auth value: mac ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        output[len + i] = mac[i] ^ stream_block[i];
-    }
+    crypto_xor(output + len, mac, stream_block, mac_length);
 
     return len + mac_length;
 }
@@ -298,9 +294,7 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
     }
 
     /* mac = input[plain_len...plain_len+mac_length] ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        mac_recv[i] = input[len + i] ^ stream_block[i];
-    }
+    crypto_xor(mac_recv, input + len, stream_block, mac_length);
 
     if (!crypto_equals(mac_recv, mac, mac_length)) {
         return CCM_ERR_INVALID_CBC_MAC;
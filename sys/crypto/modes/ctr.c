@@ -25,28 +25,28 @@ int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
-    size_t offset = 0;
+    size_t full;
     uint8_t stream_block[16] = { 0 }, block_size;
 
     block_size = cipher_get_block_size(cipher);
-    do {
-        uint8_t block_size_input;
+    full = length - length % block_size;
 
+    /* all complete blocks in one go, the cipher may process them in bulk */
+    if (full > 0 &&
+        cipher_ctr_blocks(cipher, nonce_counter, block_size - nonce_len,
+                          input, output, full / block_size) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+
+    if (full < length) {
         if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
-
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
-        }
-
-        offset += block_size_input;
+        crypto_xor(output + full, input + full, stream_block, length - full);
         crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    } while (offset < length);
+    }
 
-    return offset;
+    return length;
 }
 
 int cipher_decrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
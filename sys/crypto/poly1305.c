@@ -14,14 +14,18 @@
  * @brief   Implementation of Poly1305. Based on Floodberry's and Loup
  *          Valliant's implementation. Optimized for small flash size.
  *
+ * Full blocks are read from the input word-wise, only the bytes of a partial
+ * block are collected one at a time.
+ *
  * @author  Koen Zandberg <koen@bergzand.net>
  * @}
  */
 
+#include <stdint.h>
 #include <string.h>
 #include "crypto/poly1305.h"
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4);
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t *c, uint8_t c4);
 
 static uint32_t u8to32(const uint8_t *p)
 {
@@ -49,7 +53,21 @@ static void _clear_c(poly1305_ctx_t *ctx)
     ctx->c_idx = 0;
 }
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
+static void _load_block(uint32_t *c, const uint8_t *data)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    /* the words are stored in memory as Poly1305 expects them */
+    if (((uintptr_t)data & 0x3) == 0) {
+        memcpy(c, __builtin_assume_aligned(data, 4), POLY1305_BLOCK_SIZE);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < 4; i++) {
+        c[i] = u8to32(&data[4 * i]);
+    }
+}
+
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t *c, uint8_t c4)
 {
     /* Local copies */
     const uint32_t r0 = ctx->r[0];
@@ -63,10 +81,10 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     const uint32_t rr3 = (r3 >> 2) + r3;
 
     /* s = h + c, without carry propagation */
-    const uint64_t s0 = ctx->h[0] + (uint64_t)ctx->c[0];
-    const uint64_t s1 = ctx->h[1] + (uint64_t)ctx->c[1];
-    const uint64_t s2 = ctx->h[2] + (uint64_t)ctx->c[2];
-    const uint64_t s3 = ctx->h[3] + (uint64_t)ctx->c[3];
+    const uint64_t s0 = ctx->h[0] + (uint64_t)c[0];
+    const uint64_t s1 = ctx->h[1] + (uint64_t)c[1];
+    const uint64_t s2 = ctx->h[2] + (uint64_t)c[2];
+    const uint64_t s3 = ctx->h[3] + (uint64_t)c[3];
     const uint32_t s4 = ctx->h[4] + c4;
 
     /* (h + c) * r, without carry propagation */
@@ -103,12 +121,32 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
-        if (ctx->c_idx == 16) {
-            poly1305_block(ctx, 1);
-            _clear_c(ctx);
+    /* complete a partial block left over from the previous call */
+    if (ctx->c_idx) {
+        while (len && (ctx->c_idx < POLY1305_BLOCK_SIZE)) {
+            _take_input(ctx, *data++);
+            len--;
+        }
+        if (ctx->c_idx < POLY1305_BLOCK_SIZE) {
+            return;
         }
+        poly1305_block(ctx, ctx->c, 1);
+        _clear_c(ctx);
+    }
+
+    /* process full blocks directly from the input */
+    while (len >= POLY1305_BLOCK_SIZE) {
+        uint32_t c[4];
+
+        _load_block(c, data);
+        poly1305_block(ctx, c, 1);
+        data += POLY1305_BLOCK_SIZE;
+        len -= POLY1305_BLOCK_SIZE;
+    }
+
+    /* keep the rest for the next call */
+    while (len--) {
+        _take_input(ctx, *data++);
     }
 }
 
@@ -136,7 +174,7 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
         /* (We may add less than 2^130 to the last input block) */
         _take_input(ctx, 1);
         /* And update hash */
-        poly1305_block(ctx, 0);
+        poly1305_block(ctx, ctx->c, 0);
     }
 
     /* check if we should subtract 2^130-5 by performing the
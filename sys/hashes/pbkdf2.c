@@ -32,17 +32,6 @@ static void inplace_xor_scalar(uint8_t *bytes, size_t len, uint8_t c)
     }
 }
 
-static void inplace_xor_digests(uint8_t *d1, const uint8_t *d2)
-{
-    int len = SHA256_DIGEST_LENGTH;
-
-    while (len--) {
-        *d1 ^= *d2;
-        d1++;
-        d2++;
-    }
-}
-
 void pbkdf2_sha256(const void *password, size_t password_len,
                    const void *salt, size_t salt_len,
                    int iterations,
@@ -51,7 +40,6 @@ void pbkdf2_sha256(const void *password, size_t password_len,
     sha256_context_t inner;
     sha256_context_t outer;
     uint8_t tmp_digest[SHA256_DIGEST_LENGTH];
-    int first_iter = 1;
 
     {
         uint8_t processed_pass[SHA256_INTERNAL_BLOCK_SIZE] = {0};
@@ -82,28 +70,26 @@ void pbkdf2_sha256(const void *password, size_t password_len,
 
     memset(output, 0, SHA256_DIGEST_LENGTH);
 
-    while (iterations--) {
-        sha256_context_t inner_copy = inner, outer_copy = outer;
-
-        if (first_iter) {
-            sha256_update(&inner_copy, salt, salt_len);
-            sha256_update(&inner_copy, "\x00\x00\x00\x01", 4);
-            first_iter = 0;
-        } else {
-            sha256_update(&inner_copy, tmp_digest, sizeof(tmp_digest));
-        }
+    /* The first iteration hashes the salt, all others a digest. The latter
+     * completes the message within a single block after the key pad, so the
+     * padded contexts are finalized without copying them. */
+    if (iterations > 0) {
+        sha256_context_t inner_copy = inner;
 
+        sha256_update(&inner_copy, salt, salt_len);
+        sha256_update(&inner_copy, "\x00\x00\x00\x01", 4);
         sha256_final(&inner_copy, tmp_digest);
+        sha2xx_final_short(&outer, tmp_digest, sizeof(tmp_digest),
+                           tmp_digest, sizeof(tmp_digest));
+        memcpy(output, tmp_digest, SHA256_DIGEST_LENGTH);
+    }
 
-        sha256_update(&outer_copy, tmp_digest, sizeof(tmp_digest));
-        sha256_final(&outer_copy, tmp_digest);
-
-        inplace_xor_digests(output, tmp_digest);
-
-        if (iterations == 0) {
-            crypto_secure_wipe(&inner_copy, sizeof(inner_copy));
-            crypto_secure_wipe(&outer_copy, sizeof(outer_copy));
-        }
+    while (--iterations > 0) {
+        sha2xx_final_short(&inner, tmp_digest, sizeof(tmp_digest),
+                           tmp_digest, sizeof(tmp_digest));
+        sha2xx_final_short(&outer, tmp_digest, sizeof(tmp_digest),
+                           tmp_digest, sizeof(tmp_digest));
+        crypto_xor(output, output, tmp_digest, SHA256_DIGEST_LENGTH);
     }
 
     crypto_secure_wipe(&inner, sizeof(inner));
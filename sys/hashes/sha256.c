@@ -156,8 +156,8 @@ static inline void sha256_inplace(unsigned char element[SHA256_DIGEST_LENGTH])
     sha256_context_t ctx;
 
     sha256_init(&ctx);
-    sha2xx_update(&ctx, element, SHA256_DIGEST_LENGTH);
-    sha256_final(&ctx, element);
+    sha2xx_final_short(&ctx, element, SHA256_DIGEST_LENGTH,
+                       element, SHA256_DIGEST_LENGTH);
 }
 
 void *sha256_chain(const void *seed, size_t seed_length,
@@ -208,8 +208,8 @@ void *sha256_chain_with_waypoints(const void *seed,
         for (size_t i = 1; i < elements; ++i) {
             sha256_context_t ctx;
             sha256_init(&ctx);
-            sha2xx_update(&ctx, waypoints[(i - 1)].element, SHA256_DIGEST_LENGTH);
-            sha256_final(&ctx, waypoints[i].element);
+            sha2xx_final_short(&ctx, waypoints[(i - 1)].element, SHA256_DIGEST_LENGTH,
+                               waypoints[i].element, SHA256_DIGEST_LENGTH);
             waypoints[i].index = i;
         }
 
@@ -46,8 +46,9 @@
  * @}
  */
 
-#include <stdint.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 #include "hashes/sha2xx_common.h"
 
@@ -130,14 +131,35 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/* SHA-NI is detected at runtime on native, all other CPUs use C code */
+#if defined(CPU_NATIVE) && (defined(__x86_64__) || defined(__i386__)) && \
+    defined(__GNUC__)
+#  include <immintrin.h>
+#  define SHA_NI 1
+#else
+#  define SHA_NI 0
+#endif
+
+/**
+ * @brief One round, the caller rotates the working variables
+ */
+#define ROUND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i]; \
+        uint32_t t1 = S0(a) + Maj(a, b, c); \
+        d += t0; \
+        h = t0 + t1; \
+    } while (0)
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+static void _transform(uint32_t *state, const unsigned char block[64])
 {
     uint32_t W[64];
-    uint32_t S[8];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
     /* 1. Prepare message schedule W. */
     be32dec_vect(W, block, 64);
@@ -145,27 +167,93 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
     }
 
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
+    /* 2. Mix, eight rounds per iteration bring the variables back in place */
+    for (int i = 0; i < 64; i += 8) {
+        ROUND(a, b, c, d, e, f, g, h, i);
+        ROUND(h, a, b, c, d, e, f, g, i + 1);
+        ROUND(g, h, a, b, c, d, e, f, i + 2);
+        ROUND(f, g, h, a, b, c, d, e, i + 3);
+        ROUND(e, f, g, h, a, b, c, d, i + 4);
+        ROUND(d, e, f, g, h, a, b, c, i + 5);
+        ROUND(c, d, e, f, g, h, a, b, i + 6);
+        ROUND(b, c, d, e, f, g, h, a, i + 7);
+    }
+
+    /* 3. Mix local working variables into global state */
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
 
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
+#if SHA_NI
+static bool _shani_usable(void)
+{
+    return __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+}
 
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
+/*
+ * The SHA-NI instructions keep the state as ABEF and CDGH and do two rounds
+ * per sha256rnds2, taking the sum of the message words and constants.
+ */
+__attribute__((target("sha,sse4.1")))
+static void _shani_transform(uint32_t *state, const unsigned char block[64])
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i msg[4];
+    __m128i tmp, wk, abef, cdgh, abef_save, cdgh_save;
+
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+    abef_save = abef;
+    cdgh_save = cdgh;
+
+    for (int i = 0; i < 4; i++) {
+        msg[i] = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(const void *)&block[16 * i]), bswap);
+    }
 
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
+    for (int i = 0; i < 16; i++) {
+        wk = _mm_add_epi32(msg[i % 4],
+                           _mm_loadu_si128((const __m128i *)&K[4 * i]));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0e));
+
+        if (i < 12) {
+            /* W[4i + 16 .. 4i + 19] replaces W[4i .. 4i + 3] */
+            tmp = _mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]);
+            tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(msg[(i + 3) % 4],
+                                                     msg[(i + 2) % 4], 4));
+            msg[i % 4] = _mm_sha256msg2_epu32(tmp, msg[(i + 3) % 4]);
+        }
     }
 
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+    abef = _mm_add_epi32(abef, abef_save);
+    cdgh = _mm_add_epi32(cdgh, cdgh_save);
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(cdgh, tmp, 8));
+}
+#endif /* SHA_NI */
+
+static void sha2xx_transform(uint32_t *state, const void *block)
+{
+#if SHA_NI
+    if (_shani_usable()) {
+        _shani_transform(state, block);
+        return;
     }
+#endif
+    _transform(state, block);
 }
 
 static const unsigned char PAD[64] = {
@@ -256,3 +344,27 @@ void sha2xx_final(sha2xx_context_t *ctx, void *dst, size_t dig_len)
     /* Clear the context state */
     memset((void *) ctx, 0, sizeof(*ctx));
 }
+
+void sha2xx_final_short(const sha2xx_context_t *ctx, const void *data,
+                        size_t len, void *digest, size_t dig_len)
+{
+    uint32_t state[8];
+    uint32_t count[2];
+    unsigned char block[64];
+
+    /* The data must complete the message within a single block */
+    assert(!((ctx->count[1] >> 3) & 0x3f));
+    assert(len <= 55);
+
+    count[1] = ctx->count[1] + ((uint32_t)len << 3);
+    count[0] = ctx->count[0] + (count[1] < ctx->count[1]);
+
+    memcpy(block, data, len);
+    block[len] = 0x80;
+    memset(&block[len + 1], 0, 55 - len);
+    be32enc_vect(&block[56], count, 8);
+
+    memcpy(state, ctx->state, sizeof(state));
+    sha2xx_transform(state, block);
+    be32enc_vect(digest, state, dig_len);
+}
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_hashes_siphash
+ * @{
+ *
+ * @file
+ * @brief       SipHash-2-4 implementation
+ *
+ * @}
+ */
+
+#include "byteorder.h"
+#include "hashes/siphash.h"
+#include "unaligned.h"
+
+static inline uint64_t _rotl(uint64_t x, unsigned b)
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+static inline uint64_t _load(const uint8_t *p)
+{
+    le_uint64_t v = { .u64 = unaligned_get_u64(p) };
+
+    return byteorder_ltohll(v);
+}
+
+static inline void _round(uint64_t *v)
+{
+    v[0] += v[1];
+    v[1] = _rotl(v[1], 13);
+    v[1] ^= v[0];
+    v[0] = _rotl(v[0], 32);
+    v[2] += v[3];
+    v[3] = _rotl(v[3], 16);
+    v[3] ^= v[2];
+    v[0] += v[3];
+    v[3] = _rotl(v[3], 21);
+    v[3] ^= v[0];
+    v[2] += v[1];
+    v[1] = _rotl(v[1], 17);
+    v[1] ^= v[2];
+    v[2] = _rotl(v[2], 32);
+}
+
+static inline void _compress(uint64_t *v, uint64_t m)
+{
+    v[3] ^= m;
+    _round(v);
+    _round(v);
+    v[0] ^= m;
+}
+
+void siphash_init(siphash_context_t *ctx, const uint8_t *key)
+{
+    uint64_t k0 = _load(key);
+    uint64_t k1 = _load(key + 8);
+
+    ctx->v[0] = k0 ^ 0x736f6d6570736575ULL;
+    ctx->v[1] = k1 ^ 0x646f72616e646f6dULL;
+    ctx->v[2] = k0 ^ 0x6c7967656e657261ULL;
+    ctx->v[3] = k1 ^ 0x7465646279746573ULL;
+    ctx->m = 0;
+    ctx->len = 0;
+}
+
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+    unsigned fill = ctx->len % 8;
+
+    ctx->len += len;
+
+    /* complete the word started by a previous call first */
+    if (fill) {
+        while ((fill < 8) && len) {
+            ctx->m |= (uint64_t)*in++ << (8 * fill++);
+            len--;
+        }
+        if (fill < 8) {
+            return;
+        }
+        _compress(ctx->v, ctx->m);
+        ctx->m = 0;
+    }
+
+    for (; len >= 8; in += 8, len -= 8) {
+        _compress(ctx->v, _load(in));
+    }
+
+    for (unsigned i = 0; i < len; i++) {
+        ctx->m |= (uint64_t)in[i] << (8 * i);
+    }
+}
+
+uint64_t siphash_final(siphash_context_t *ctx)
+{
+    uint64_t *v = ctx->v;
+
+    _compress(v, ((uint64_t)ctx->len << 56) | ctx->m);
+    v[2] ^= 0xff;
+    _round(v);
+    _round(v);
+    _round(v);
+    _round(v);
+
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+uint64_t siphash(const uint8_t *key, const void *data, size_t len)
+{
+    siphash_context_t ctx;
+
+    siphash_init(&ctx, key);
+    siphash_update(&ctx, data, len);
+    return siphash_final(&ctx);
+}
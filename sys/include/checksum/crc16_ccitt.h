@@ -24,6 +24,8 @@
  *
  *              @note enable the `crc16_fast` module for a look-up table based
  *              implementation that trades code size for speed.
+ *              `crc16_slice4` additionally processes four bytes per step
+ *              using another 1.5 KiB of tables.
  *
  * @{
  * @file
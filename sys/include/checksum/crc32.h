@@ -32,7 +32,12 @@ extern "C" {
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed. `crc32_slice4` and `crc32_slice8`
+ *       process four or eight bytes per step using another 3 KiB or 7 KiB
+ *       of tables.
+ *       The `crc32_hw` module uses the carry-less multiply (PCLMULQDQ)
+ *       instruction on x86_64 if the CPU supports it, or the CRC32
+ *       instructions on ARMv8 if the compiler targets them.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
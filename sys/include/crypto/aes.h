@@ -29,6 +29,7 @@
  * @author      Zakaria Kasmi <zkasmi@inf.fu-berlin.de>
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include "crypto/ciphers.h"
 
@@ -124,6 +125,62 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts @p num consecutive blocks, expanding the key only once.
+ *
+ * On native, AES-NI is used if the host CPU supports it.
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        encryption
+ * @param       plain     @p num blocks of plaintext
+ * @param       cipher    @p num blocks of memory for the ciphertext, may be
+ *                        equal to @p plain
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t num);
+
+/**
+ * @brief   decrypts @p num consecutive blocks, expanding the key only once.
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        decryption
+ * @param       cipher    @p num blocks of ciphertext
+ * @param       plain     @p num blocks of memory for the plaintext, may be
+ *                        equal to @p cipher
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *cipher,
+                       uint8_t *plain, size_t num);
+
+/**
+ * @brief   XORs the AES key stream of @p num counter blocks onto @p in.
+ *
+ * @param       context   the cipher_context_t-struct to use
+ * @param       ctr       counter block, the last @p ctr_len bytes are
+ *                        incremented after each block
+ * @param       ctr_len   length of the counter in @p ctr
+ * @param       in        @p num blocks of input
+ * @param       out       @p num blocks of memory for the output, may be
+ *                        equal to @p in
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_ctr_blocks(const cipher_context_t *context, uint8_t *ctr,
+                   uint8_t ctr_len, const uint8_t *in, uint8_t *out,
+                   size_t num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -78,6 +78,9 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
  *
  * It is allowed to have cipher == msg
  *
+ * The ciphertext is decrypted while the tag is calculated. If the tag does
+ * not match, @p msg is wiped, so with cipher == msg the ciphertext is lost.
+ *
  * @param[in]   cipher      resulting ciphertext, is CHACHA20POLY1305_TAG_BYTES
  *                          longer than the message length
  * @param[in]   cipherlen   length of the ciphertext
@@ -89,6 +92,9 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
  *                          CHACHA20POLY1305_KEY_BYTES long
  * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
  *                          long
+ *
+ * @return      1 if the tag is valid
+ * @return      0 otherwise
  */
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              uint8_t *msg, size_t *msglen,
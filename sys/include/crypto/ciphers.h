@@ -21,6 +21,7 @@
  * @author      Mark Essien <markessien@gmail.com>
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -101,6 +102,28 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief encrypts @p num consecutive blocks (ECB), NULL if not supported
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *plain,
+                          uint8_t *cipher, size_t num);
+
+    /**
+     * @brief decrypts @p num consecutive blocks (ECB), NULL if not supported
+     */
+    int (*decrypt_blocks)(const cipher_context_t *ctx, const uint8_t *cipher,
+                          uint8_t *plain, size_t num);
+
+    /**
+     * @brief XORs the key stream of @p num counter blocks onto @p in,
+     *        NULL if not supported
+     *
+     * The last @p ctr_len bytes of @p ctr are incremented after each block.
+     */
+    int (*ctr_blocks)(const cipher_context_t *ctx, uint8_t *ctr,
+                      uint8_t ctr_len, const uint8_t *in, uint8_t *out,
+                      size_t num);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -172,6 +195,60 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt @p num consecutive blocks of BLOCK_SIZE length
+ *
+ * Uses the multi-block operation of the cipher if it provides one, which
+ * e.g. expands the key only once, and falls back to @ref cipher_encrypt
+ * otherwise.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size @p num * BLOCK_SIZE. May be equal to @p input.
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+/**
+ * @brief Decrypt @p num consecutive blocks of BLOCK_SIZE length
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to decrypt
+ * @param output     pointer to allocated memory for decrypted data. It has to
+ *                   be of size @p num * BLOCK_SIZE. May be equal to @p input.
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+/**
+ * @brief Encrypt or decrypt @p num blocks in counter mode
+ *
+ * The key stream is generated by encrypting @p ctr, whose last @p ctr_len
+ * bytes are incremented after each block, and XORed onto @p input.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param ctr        counter block of BLOCK_SIZE length, updated in place
+ * @param ctr_len    length of the counter in @p ctr
+ * @param input      pointer to input data
+ * @param output     pointer to allocated memory of size @p num * BLOCK_SIZE.
+ *                   May be equal to @p input.
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_ctr_blocks(const cipher_t *cipher, uint8_t *ctr, uint8_t ctr_len,
+                      const uint8_t *input, uint8_t *output, size_t num);
+
 /**
  * @brief Get block size of cipher
  * *
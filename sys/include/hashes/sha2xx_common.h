@@ -93,6 +93,23 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief SHA-2XX finalization for messages whose last bytes fit into a single
+ *        block, e.g. when hashing a digest. @p ctx is left untouched, so it
+ *        can be reused for the next message with the same prefix.
+ *
+ * @pre The number of bytes hashed into @p ctx is a multiple of 64 and
+ *      @p len is at most 55.
+ *
+ * @param[in] ctx     sha2xx_context_t handle holding the message prefix
+ * @param[in] data    Last bytes of the message
+ * @param[in] len     Length of @p data
+ * @param[out] digest resulting digest, may overlap with @p data
+ * @param dig_len     Length of @p digest
+ */
+void sha2xx_final_short(const sha2xx_context_t *ctx, const void *data,
+                        size_t len, void *digest, size_t dig_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_hashes_siphash SipHash
+ * @ingroup     sys_hashes_keyed
+ * @brief       Implementation of the SipHash-2-4 keyed hash function
+ *
+ * SipHash is a short-input pseudorandom function with a 128 bit key and a
+ * 64 bit output. It is much cheaper than a cryptographic hash function such
+ * as SHA-256, while an attacker not knowing the key can neither predict nor
+ * provoke collisions. This makes it a good fit for hash tables indexed by
+ * untrusted input.
+ *
+ * @see         https://www.aumasson.jp/siphash/siphash.pdf
+ *
+ * @{
+ *
+ * @file
+ * @brief       SipHash-2-4 interface definition
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Length of a SipHash key in bytes
+ */
+#define SIPHASH_KEY_LENGTH          (16U)
+
+/**
+ * @brief   Length of a SipHash-2-4 digest in bytes
+ */
+#define SIPHASH_DIGEST_LENGTH       (8U)
+
+/**
+ * @brief   SipHash calculation context
+ */
+typedef struct {
+    uint64_t v[4];      /**< internal state */
+    uint64_t m;         /**< bytes of the current word not yet processed */
+    size_t len;         /**< overall number of bytes processed */
+} siphash_context_t;
+
+/**
+ * @brief   Initialize a SipHash-2-4 calculation context
+ *
+ * @param[out] ctx      context to initialize
+ * @param[in]  key      key of @ref SIPHASH_KEY_LENGTH bytes
+ */
+void siphash_init(siphash_context_t *ctx, const uint8_t *key);
+
+/**
+ * @brief   Add bytes into the hash
+ *
+ * @param[in,out] ctx   context to update
+ * @param[in]     data  input data
+ * @param[in]     len   length of @p data in bytes
+ */
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief   Finish the hash calculation
+ *
+ * @param[in,out] ctx   context to finish, invalid afterwards
+ *
+ * @return  the 64 bit digest
+ */
+uint64_t siphash_final(siphash_context_t *ctx);
+
+/**
+ * @brief   Calculate the SipHash-2-4 digest of a buffer in one go
+ *
+ * @param[in] key       key of @ref SIPHASH_KEY_LENGTH bytes
+ * @param[in] data      input data
+ * @param[in] len       length of @p data in bytes
+ *
+ * @return  the 64 bit digest
+ */
+uint64_t siphash(const uint8_t *key, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
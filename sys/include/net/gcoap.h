@@ -368,6 +368,32 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Indexed lookup ###
+ *
+ * By default, responses, Observe registrations and requests for resources
+ * are matched by searching the respective tables and listeners linearly. For
+ * large configurations, e.g. a proxy with many open requests, use module
+ * `gcoap_index`. It keeps hash indexes over open requests (by token and by
+ * message ID), Observe registrations (by token and by resource), observers
+ * and the resource paths of listeners using the default request matcher, so
+ * matching an incoming message no longer depends on the number of entries.
+ * See @ref CONFIG_GCOAP_REQ_INDEX_SIZE, @ref CONFIG_GCOAP_OBS_INDEX_SIZE and
+ * @ref CONFIG_GCOAP_RESOURCE_INDEX_SIZE for the sizes of the indexes.
+ *
+ * ### Worker threads ###
+ *
+ * By default, the gcoap thread runs all resource handlers itself, so a slow
+ * handler delays every other request, response and retransmission. With
+ * module `gcoap_workers`, requests received via plain UDP are copied into one
+ * of @ref CONFIG_GCOAP_WORKER_JOBS job buffers and handled by a pool of
+ * @ref CONFIG_GCOAP_WORKERS_NUMOF worker threads, each waiting on its own
+ * event queue. The gcoap thread keeps receiving, matches responses and
+ * handles retransmissions, empty messages and DTLS requests. If no job buffer
+ * is free, a request is answered with 5.03 Service Unavailable.
+ *
+ * Resource handlers then may run concurrently and must protect any state
+ * they share. Observe registrations are serialized by gcoap.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -586,6 +612,68 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of slots in the hash indexes over open requests
+ *
+ * With module `gcoap_index`, responses are matched to open requests by token
+ * and by message ID via hash indexes of this size. Must be at least 4/3 of
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX, larger values shorten the probe
+ * sequences.
+ */
+#ifndef CONFIG_GCOAP_REQ_INDEX_SIZE
+#define CONFIG_GCOAP_REQ_INDEX_SIZE     (2 * CONFIG_GCOAP_REQ_WAITING_MAX)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of slots in the hash indexes over Observe registrations
+ *
+ * With module `gcoap_index`, Observe registrations are looked up by token and
+ * by resource, and observers by endpoint, via hash indexes of this size. Must
+ * be at least 4/3 of @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX.
+ */
+#ifndef CONFIG_GCOAP_OBS_INDEX_SIZE
+#define CONFIG_GCOAP_OBS_INDEX_SIZE     (2 * CONFIG_GCOAP_OBS_REGISTRATIONS_MAX)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of slots in the hash index over resource paths
+ *
+ * With module `gcoap_index`, the resources of all listeners using the default
+ * request matcher are hashed by path. Up to 3/4 of the slots are used, if
+ * more resources are registered, requests are matched by searching the
+ * listeners again.
+ */
+#ifndef CONFIG_GCOAP_RESOURCE_INDEX_SIZE
+#define CONFIG_GCOAP_RESOURCE_INDEX_SIZE    (32)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of worker threads handling requests
+ *
+ * Only used with module `gcoap_workers`, see @ref GCOAP_WORKER_STACK_SIZE
+ * for the stack each worker needs.
+ */
+#ifndef CONFIG_GCOAP_WORKERS_NUMOF
+#define CONFIG_GCOAP_WORKERS_NUMOF      (2)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of received requests that can wait for or be handled by a
+ *          worker
+ *
+ * Each job holds a PDU buffer of @ref CONFIG_GCOAP_PDU_BUF_SIZE bytes. If all
+ * jobs are in use, further requests are answered with 5.03 Service
+ * Unavailable. Only used with module `gcoap_workers`.
+ */
+#ifndef CONFIG_GCOAP_WORKER_JOBS
+#define CONFIG_GCOAP_WORKER_JOBS        (2 * CONFIG_GCOAP_WORKERS_NUMOF)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -668,6 +756,24 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief Stack size for each worker thread of module `gcoap_workers`
+ */
+#ifndef GCOAP_WORKER_STACK_SIZE
+#define GCOAP_WORKER_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
+                                 + sizeof(coap_pkt_t) + GCOAP_VFS_EXTRA_STACKSIZE)
+#endif
+
+/**
+ * @brief Priority of the worker threads of module `gcoap_workers`
+ *
+ * Defaults to one below the gcoap thread, so receiving, acknowledging and
+ * retransmitting messages is not delayed by a resource handler.
+ */
+#ifndef GCOAP_WORKER_PRIO
+#define GCOAP_WORKER_PRIO       (THREAD_PRIORITY_MAIN)
+#endif
+
 /**
  * @ingroup net_gcoap_conf
  * @brief   Count of PDU buffers available for resending confirmable messages
@@ -78,6 +78,12 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_DNS                    1
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_OFFL_TRIE
+#  ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#    define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE            1
+#  endif
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -206,6 +212,20 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_REDIRECT               0
 #endif
 
+/**
+ * @brief   (de-)activate longest prefix match index for off-link entries
+ *
+ * When active, the NIB keeps a path-compressed binary trie (Patricia trie)
+ * over the prefixes of its off-link entries, so next-hop determination for a
+ * destination takes time proportional to the prefix length instead of the
+ * number of off-link entries (see @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF).
+ * The number of trie nodes is capped by
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE_NUMOF.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE              0
+#endif
+
 /**
  * @brief   (de-)activate destination cache
  */
@@ -323,6 +343,22 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Maximum number of nodes in the longest prefix match trie
+ *
+ * Every off-link entry with a distinct prefix needs one node, plus up to one
+ * branching node per such entry. With the default of twice
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, all off-link entries are always
+ * indexed. If this is set lower and the trie runs out of nodes, the NIB falls
+ * back to a linear search over all off-link entries until enough entries were
+ * removed to index all of them again.
+ *
+ * @note    Only applicable with @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE_NUMOF
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE_NUMOF   (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -35,6 +35,27 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC network protocol registry compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets of the registry
+ *
+ * With the `gnrc_netreg_hash` module, entries are kept in
+ * @ref CONFIG_GNRC_NETREG_HASH_BUCKETS lists selected by a hash over both
+ * the @ref gnrc_nettype_t and the gnrc_netreg_entry_t::demux_ctx, instead of
+ * one list per @ref gnrc_nettype_t. This makes a lookup independent of the
+ * number of other entries (e.g. sockets) registered for the same type.
+ *
+ * @note    Should be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS     (16U)
+#endif
+/** @} */
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -79,6 +100,13 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+#if defined(MODULE_GNRC_NETREG_HASH)
+/* initializer for gnrc_netreg_entry_t::nettype, set on registration */
+#define _GNRC_NETREG_NETTYPE_INIT   GNRC_NETTYPE_UNDEF,
+#else
+#define _GNRC_NETREG_NETTYPE_INIT
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -95,10 +123,13 @@ typedef enum {
  */
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
+                                                      _GNRC_NETREG_NETTYPE_INIT \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
+                                                      _GNRC_NETREG_NETTYPE_INIT \
+                                                      { pid } }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -114,6 +145,7 @@ typedef enum {
  * @return  An initialized netreg entry
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
+                                                       _GNRC_NETREG_NETTYPE_INIT \
                                                        GNRC_NETREG_TYPE_MBOX, \
                                                        { .mbox = _mbox } }
 #endif
@@ -131,6 +163,7 @@ typedef enum {
  * @return  An initialized netreg entry
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
+                                                      _GNRC_NETREG_NETTYPE_INIT \
                                                       GNRC_NETREG_TYPE_CB, \
                                                       { .cbd = _cbd } }
 /** @} */
@@ -180,6 +213,16 @@ typedef struct gnrc_netreg_entry {
      *          ports in UDP/TCP, or similar.
      */
     uint32_t demux_ctx;
+#if defined(MODULE_GNRC_NETREG_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   The protocol type the entry is registered for
+     *
+     * @note    Only available with `gnrc_netreg_hash`.
+     *
+     * @internal
+     */
+    gnrc_nettype_t nettype;
+#endif
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
     /**
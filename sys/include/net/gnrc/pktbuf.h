@@ -63,6 +63,33 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of objects per size class of the slab front-end
+ *
+ * With the `gnrc_pktbuf_static_slab` module, small allocations (packet snip
+ * descriptors and short headers) are served from fixed-size objects instead
+ * of the general first-fit allocator of the static packet buffer. For each
+ * size class, this many objects are carved from the start of the packet
+ * buffer arena. If a class runs out of objects, the general allocator is
+ * used.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Object size of the header size class of the slab front-end
+ *
+ * The default fits an IPv6 header or a @ref gnrc_netif_hdr_t with two 8 byte
+ * link-layer addresses. Must be a multiple of 8. A second size class for
+ * @ref gnrc_pktsnip_t is always present.
+ *
+ * @note    Only applicable with the `gnrc_pktbuf_static_slab` module.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE (48)
+#endif
 /** @} */
 
 /**
@@ -302,7 +329,9 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_static_slab`, the high-water mark of each slab size
+ *          class and the fragmentation of the remaining arena are included.
  */
 void gnrc_pktbuf_stats(void);
 #endif
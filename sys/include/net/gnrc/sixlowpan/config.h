@@ -157,6 +157,22 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE */
 
+/**
+ * @brief   Number of slots in the hash index of the virtual reassembly buffer
+ *
+ * VRB entries are looked up by (link-layer source address, tag) of a fragment
+ * via an open-addressing hash index, so forwarding a fragment does not need
+ * to scan the whole VRB. Must be at least
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE, larger values shorten the probe
+ * sequences.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE  (2 * CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE */
+
 /**
  * @brief   Timeout for a VRB entry in microseconds
  *
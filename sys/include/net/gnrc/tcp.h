@@ -120,6 +120,30 @@ int gnrc_tcp_init(void);
  */
 void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief Use a user provided congestion control for a connection.
+ *
+ * Without a call to this function, a connection takes a state object from
+ * the pool of the selected `gnrc_tcp_congure_%` sub-module.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre The connection of @p tcb must be closed.
+ * @pre @p tcb and @p cong must not be NULL.
+ * @pre @p cong must have been set up with the window unit
+ *      @ref GNRC_TCP_CONGURE_UNIT.
+ *
+ * @note GNRC TCP retransmits lost segments itself, the callbacks of
+ *       @p cong only have to maintain the congestion window.
+ * @note Requires module `gnrc_tcp_congure`.
+ *
+ * @param[in,out] tcb    TCB to use @p cong for.
+ * @param[in]     cong   CongURE state object. It must stay valid until the
+ *                       connection of @p tcb is closed.
+ */
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *cong);
+#endif
+
 /**
  * @brief Initialize Transmission Control Block (TCB) queue
  * @pre @p queue must not be NULL.
@@ -212,7 +236,11 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Blocks until up to @p len bytes were queued for transmission or an error occurred.
+ *       Queued data is retransmitted until it is acknowledged or the connection is
+ *       closed. If the peer acknowledges no retransmission for
+ *       CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS, the connection is aborted
+ *       and further calls return -ECONNABORTED.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -229,6 +257,7 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @return   -ECONNRESET if connection was reset by the peer.
  * @return   -ECONNABORTED if the connection was aborted.
  * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ * @return   -ENOMEM if no segment could be allocated.
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
@@ -107,6 +107,59 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Enable the Window Scale Option (RFC 7323). Enabled by default.
+ *
+ * @note The option is negotiated during connection setup. If the peer agrees,
+ *       receive buffers and peer windows larger than 64 KiB can be used.
+ */
+#ifndef CONFIG_GNRC_TCP_WSCALE_EN
+#define CONFIG_GNRC_TCP_WSCALE_EN 1
+#endif
+
+/**
+ * @brief Enable Selective Acknowledgments (RFC 2018). Enabled by default.
+ *
+ * @note If the peer agrees during connection setup, every ACK reports up to
+ *       four blocks of data received out of order.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_EN
+#define CONFIG_GNRC_TCP_SACK_EN 1
+#endif
+
+/**
+ * @brief Number of out-of-order data blocks tracked per connection
+ *
+ * Segments arriving out of order are stored in the receive buffer, so that
+ * only the missing ones must be retransmitted. Data beyond the tracked blocks
+ * is dropped.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_BLOCKS
+#define CONFIG_GNRC_TCP_RCV_OOO_BLOCKS (4U)
+#endif
+
+/**
+ * @brief Number of segments per connection that can wait for an acknowledgment
+ *
+ * Each segment sent holds its packet in the packet buffer until it was
+ * acknowledged. Without module `gnrc_tcp_congure` only one data segment is
+ * sent at a time.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Lower bound in microseconds for the gap between two data segments
+ *
+ * Only used with module `gnrc_tcp_pacing`. The gap between segments is derived
+ * from the congestion window and the round trip time, this value bounds it
+ * from below.
+ */
+#ifndef CONFIG_GNRC_TCP_PACING_MIN_GAP_US
+#define CONFIG_GNRC_TCP_PACING_MIN_GAP_US (0U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup net_gnrc_tcp_congure Congestion control for GNRC TCP
+ * @ingroup net_gnrc_tcp
+ *
+ * @brief Congestion control for GNRC TCP using the @ref sys_congure
+ *
+ * When included, this module lets GNRC TCP send as many segments as the
+ * congestion window allows, instead of one at a time. The flavor of
+ * congestion control can be selected using the following sub-modules:
+ *
+ * - `gnrc_tcp_congure_reno` (the default): TCP Reno
+ * - `gnrc_tcp_congure_abe`: TCP Reno with Alternative Backoff with ECN
+ * - `gnrc_tcp_congure_quic`: The RTT based congestion control of QUIC
+ *
+ * A connection can also use its own CongURE state object, see
+ * @ref gnrc_tcp_tcb_set_congure().
+ *
+ * With the module `gnrc_tcp_pacing`, data segments are additionally spread
+ * over the round trip time on @ref ZTIMER_USEC, so that a full congestion
+ * window is not handed to the link layer in one burst.
+ * @{
+ *
+ * @file
+ * @brief   Congure definitions for @ref net_gnrc_tcp
+ */
+
+#include "congure.h"
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The user-defined window unit for congure is one byte with TCP
+ */
+#define GNRC_TCP_CONGURE_UNIT   (1U)
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || DOXYGEN
+/**
+ * @brief   Retrieve CongURE state object from a pool of free objects
+ *
+ * Needs to be defined for each CongURE implementation `congure_x` e.g. as
+ * a sub-module `gnrc_tcp_congure_x` and call the respective
+ * `congure_x_snd_setup` function when a free object is available for that
+ * object. As such, congure_snd_t::driver == NULL can be used as an identifier
+ * if a state object is free.
+ *
+ * The pool of objects has to have an initial size of at least
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS.
+ *
+ * The window unit is @ref GNRC_TCP_CONGURE_UNIT.
+ *
+ * @return  A CongURE state object on success
+ * @return  NULL, if no free CongURE state object is available (including when
+ *          when module `gnrc_tcp_congure` is not included).
+ */
+congure_snd_t *gnrc_tcp_congure_snd_get(void);
+#else
+static inline congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    return NULL;
+}
+#endif
+
+/**
+ * @brief   Frees the CongURE state object
+ *
+ * This makes a CongURE state object retrievable with
+ * @ref gnrc_tcp_congure_snd_get again.
+ *
+ * @pre CongURE object is not NULL when called with module `gnrc_tcp_congure`
+ *      used.
+ *
+ * @param[in] c     A CongURE state object
+ *
+ * @note    Does not do anything without the module `gnrc_tcp_congure`
+ */
+static inline void gnrc_tcp_congure_snd_free(congure_snd_t *c)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    c->driver = NULL;
+#else
+    (void)c;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
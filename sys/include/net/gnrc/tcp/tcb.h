@@ -26,9 +26,17 @@
 #include "evtimer_mbox.h"
 #include "msg.h"
 #include "mbox.h"
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "config.h"
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "congure.h"
+#endif
+#if IS_USED(MODULE_GNRC_TCP_PACING)
+#include "ztimer.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
@@ -37,6 +45,27 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Block of sequence numbers received out of order.
+ */
+typedef struct {
+    uint32_t left;         /**< First sequence number of the block */
+    uint32_t right;        /**< Sequence number following the block */
+} gnrc_tcp_seq_block_t;
+
+/**
+ * @brief Segment that was sent and waits for an acknowledgment.
+ */
+typedef struct {
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+    congure_snd_msg_t msg; /**< Payload as reported to congestion control */
+#endif
+    gnrc_pktsnip_t *pkt;   /**< Packet to retransmit */
+    uint32_t seq;          /**< First sequence number of the segment */
+    uint16_t len;          /**< Sequence number consumption of the segment */
+    uint8_t flags;         /**< Retransmission state of the segment */
+} gnrc_tcp_snd_seg_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -50,26 +79,43 @@ typedef struct sock_tcp {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wscale;    /**< Shift count of the peers window */
+    uint8_t rcv_wscale;    /**< Shift count of the announced receive window */
+    uint8_t rcv_ooo_num;   /**< Number of blocks in rcv_ooo */
+    gnrc_tcp_seq_block_t rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_BLOCKS]; /**< Data received out of
+                                                                       order, most recent first */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number the rtt is measured with */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+    uint32_t snd_recover;  /**< snd_nxt when loss recovery started */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    uint8_t snd_queue_num;                /**< Number of segments in snd_queue */
+    gnrc_tcp_snd_seg_t snd_queue[CONFIG_GNRC_TCP_SND_QUEUE_SIZE]; /**< Segments waiting for
+                                                                       an ACK, oldest first */
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+    congure_snd_t *congure;  /**< Congestion control of the connection */
+#endif
+#if IS_USED(MODULE_GNRC_TCP_PACING) || defined(DOXYGEN)
+    ztimer_t pacing_timer;   /**< Timer delaying the next data segment */
+    msg_t pacing_msg;        /**< Message sent by pacing_timer */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
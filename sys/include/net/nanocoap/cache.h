@@ -13,6 +13,23 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Entries are found via a hash table over their cache keys and replaced in
+ * least recently used order, so neither depends on the number of entries.
+ *
+ * Each entry is also filed in a timer wheel of
+ * @ref CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS one-second slots, under the second
+ * it becomes stale in. Whenever the cache is accessed, the slots passed since
+ * the last access are checked. Stale entries without an ETag are freed right
+ * away. Stale entries with an ETag are kept for validation, but are the
+ * next to be replaced.
+ *
+ * Cache keys are derived from the request with SHA-256, truncated to
+ * @ref CONFIG_NANOCOAP_CACHE_KEY_LENGTH bytes. With the
+ * `nanocoap_cache_siphash` module, the much cheaper SipHash-2-4 is used
+ * instead, keyed with random bytes drawn on nanocoap_cache_init(). As keys
+ * then differ with every boot, they can neither be predicted nor be made to
+ * collide on purpose. The key length is limited to 8 bytes in this mode.
+ *
  * @{
  *
  * @file
@@ -54,6 +71,23 @@ extern "C" {
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief The number of hash buckets to look up cache entries.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (CONFIG_NANOCOAP_CACHE_ENTRIES)
+#endif
+
+/**
+ * @brief The number of one-second slots of the expiry wheel.
+ *
+ * Entries becoming stale more than this number of seconds ahead are checked
+ * once per revolution.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS
+#define CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS      (64)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
@@ -92,6 +126,16 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics, counted since nanocoap_cache_init()
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry (stale or not) */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make room */
+    uint32_t expirations;   /**< stale entries freed by the expiry wheel */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -136,6 +180,13 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Gets the cache statistics
+ *
+ * @param[out] stats    The statistics
+ */
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
@@ -215,7 +266,8 @@ int nanocoap_cache_del(const nanocoap_cache_entry_t *ce);
  * @brief   Generates a cache key based on the request @p req.
  *
  * @param[in] req           The request to generate the cache key from
- * @param[out] cache_key    The generated cache key
+ * @param[out] cache_key    The generated cache key, the buffer must hold
+ *                          SHA256_DIGEST_LENGTH bytes
  */
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key);
 
@@ -375,6 +375,22 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A message slot for @ref sock_udp_recv_many()
+ */
+typedef struct {
+    void *data;             /**< buffer for the payload */
+    size_t max_len;         /**< size of sock_udp_msg_t::data */
+    /**
+     * @brief   Length of the received payload
+     *
+     * -ENOBUFS if it did not fit into sock_udp_msg_t::data, -EPROTO if the
+     * source did not match the remote of the sock.
+     */
+    ssize_t len;
+    sock_udp_ep_t remote;   /**< remote end point of the message */
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -536,6 +552,41 @@ static inline ssize_t sock_udp_recv(sock_udp_t *sock,
     return sock_udp_recv_aux(sock, data, max_len, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple queued UDP messages in one call
+ *
+ * Waits for the first message like @ref sock_udp_recv() does, then takes
+ * further messages only as long as they are already queued. This way the
+ * timeout is set up once for a whole burst of messages.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (numof > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Message slots. sock_udp_msg_t::data and
+ *                      sock_udp_msg_t::max_len need to be set by the caller.
+ * @param[in] numof     Number of slots in @p msgs.
+ * @param[in] timeout   Timeout for the first message in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is currently only implemented by GNRC.
+ *
+ * @return  The number of slots filled. Slots may carry a negative
+ *          sock_udp_msg_t::len for a message that could not be received.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p sock is not properly initialized (or closed while
+ *          sock_udp_recv_many() blocks).
+ * @return  -ENOMEM, if no memory was available to receive the message.
+ * @return  -EPROTO, if source address of the first message did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned numof,
+                       uint32_t timeout);
+
 /**
  * @brief   Provides stack-internal buffer space containing a UDP message from
  *          a remote end point
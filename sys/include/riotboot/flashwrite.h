@@ -52,6 +52,12 @@
  * fit into this and FLASHPAGE_SIZE must be a multiple of
  * RIOTBOOT_FLASHPAGE_BUFFER_SIZE
  *
+ * With module `riotboot_flashwrite_sha256`, a SHA-256 digest of the image is
+ * computed while the image is written. Each chunk is added to the digest
+ * when riotboot_flashwrite_putbytes() copies it into the page buffer, so
+ * riotboot_flashwrite_verify_sha256_state() can check the image right after
+ * the last chunk without reading back the slot.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  *
@@ -62,8 +68,14 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
+#include "modules.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256) || DOXYGEN
+#include "hashes/sha256.h"
+#endif
 
 /**
  * @brief Enable/disable raw writes to flash
@@ -120,6 +132,12 @@ typedef struct {
     uint8_t RIOTBOOT_FLASHPAGE_BUFFER_ATTRS
         firstblock_buf[RIOTBOOT_FLASHPAGE_BUFFER_SIZE];
 #endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256) || DOXYGEN
+    /**
+     * @brief Running digest of the image written so far
+     */
+    sha256_context_t sha256;
+#endif
 } riotboot_flashwrite_t;
 
 /**
@@ -164,8 +182,14 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
                                            int target_slot)
 {
     /* initialize state, but skip "RIOT" */
-    return riotboot_flashwrite_init_raw(state, target_slot,
-                                        RIOTBOOT_FLASHWRITE_SKIPLEN);
+    int res = riotboot_flashwrite_init_raw(state, target_slot,
+                                           RIOTBOOT_FLASHWRITE_SKIPLEN);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    /* riotboot_flashwrite_finish() adds the magic number later */
+    sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+#endif
+    return res;
 }
 
 /**
@@ -272,6 +296,32 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Verify the digest of an image against the digest computed
+ *              while writing it
+ *
+ * Requires module `riotboot_flashwrite_sha256`. The digest covers all bytes
+ * passed to riotboot_flashwrite_putbytes(). If the update was initialized with
+ * riotboot_flashwrite_init(), riotboot's magic number is hashed in front of
+ * them, like riotboot_flashwrite_verify_sha256() does. After
+ * riotboot_flashwrite_init_raw(), bytes before its offset are not covered.
+ *
+ * Unlike riotboot_flashwrite_verify_sha256(), this does not read back the
+ * slot and works before riotboot_flashwrite_finish().
+ *
+ * @param[in]   state           ptr to the state of the update
+ * @param[in]   sha256_digest   content of the image digest
+ * @param[in]   img_size        the size of the image
+ *
+ * @returns     -1 when image is too small
+ * @returns     0 if the digest is valid
+ * @returns     1 if the digest is invalid or not @p img_size bytes were
+ *              written
+ */
+int riotboot_flashwrite_verify_sha256_state(const riotboot_flashwrite_t *state,
+                                            const uint8_t *sha256_digest,
+                                            size_t img_size);
+
 #ifdef __cplusplus
 }
 #endif
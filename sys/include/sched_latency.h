@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sched_latency Scheduler latency histogram
+ * @ingroup     sys
+ * @brief       Records how long threads wait from being woken up until they
+ *              actually run
+ *
+ * When this module is used, the scheduler notes the time a thread is put on a
+ * run queue (i.e. `sched_set_status()` makes it runnable) and the time it is
+ * eventually switched to. The difference, the wakeup latency, is accounted in
+ * a logarithmic histogram per priority. Additionally, the number of times a
+ * running thread of a priority is descheduled while still runnable is counted
+ * (preemptions, including `thread_yield()`).
+ *
+ * All data is kept in fixed size arrays, no allocation takes place. Without
+ * this module the scheduler hooks are compiled out entirely.
+ *
+ * The histograms are printed by the `ps` shell command and can be retrieved
+ * with @ref sched_latency_get().
+ *
+ * @note        If auto_init is disabled `sched_latency_init()` needs to be
+ *              called after `ztimer_init()`. No latencies are recorded before.
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency histogram
+ */
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of histogram buckets per priority
+ *
+ * Bucket 0 counts latencies below 1 µs, bucket `n` counts latencies in
+ * [2^(n - 1), 2^n) µs. The last bucket also counts all larger latencies.
+ */
+#ifndef CONFIG_SCHED_LATENCY_BUCKETS
+#define CONFIG_SCHED_LATENCY_BUCKETS    (12U)
+#endif
+
+/**
+ * @brief   Latency statistics of one priority
+ */
+typedef struct {
+    uint32_t hist[CONFIG_SCHED_LATENCY_BUCKETS];    /**< wakeups per bucket */
+    uint32_t wakeups;       /**< number of recorded wakeups */
+    uint32_t max_us;        /**< largest wakeup latency in µs */
+    uint32_t preemptions;   /**< number of times a running thread was
+                             *   descheduled while still runnable */
+} sched_latency_stats_t;
+
+/**
+ * @brief   Starts recording and resets all statistics
+ */
+void sched_latency_init(void);
+
+/**
+ * @brief   Resets all statistics
+ *
+ * Wakeups pending at the time of the call are still recorded when the thread
+ * runs.
+ */
+void sched_latency_reset(void);
+
+/**
+ * @brief   Gets a consistent copy of the statistics of a priority
+ *
+ * @pre `prio < SCHED_PRIO_LEVELS`
+ *
+ * @param[in] prio      A thread priority.
+ * @param[out] stats    The statistics of @p prio.
+ */
+void sched_latency_get(uint8_t prio, sched_latency_stats_t *stats);
+
+/**
+ * @brief   Gets the exclusive upper bound of a histogram bucket
+ *
+ * @param[in] bucket    A bucket index.
+ *
+ * @return  Upper bound of @p bucket in µs.
+ * @return  UINT32_MAX for the last bucket.
+ */
+static inline uint32_t sched_latency_bucket_limit(unsigned bucket)
+{
+    return (bucket < (CONFIG_SCHED_LATENCY_BUCKETS - 1)) ? (1UL << bucket)
+                                                         : UINT32_MAX;
+}
+
+/**
+ * @brief   Prints the statistics of all priorities with recorded events
+ */
+void sched_latency_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
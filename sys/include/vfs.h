@@ -237,6 +237,28 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef CONFIG_VFS_MOUNT_INDEX_SIZE
+/**
+ * @brief Number of mount points kept in the index used to resolve paths
+ *
+ * Paths are matched against mount points in order of descending length, so
+ * the search stops at the first match. With more mount points than this, the
+ * list of all mount points is searched instead. 0 disables the index.
+ */
+#define CONFIG_VFS_MOUNT_INDEX_SIZE (8)
+#endif
+
+#ifndef CONFIG_VFS_READAHEAD_SIZE
+/**
+ * @brief Size of the per file read-ahead buffer in bytes
+ *
+ * Only used with the `vfs_readahead` module. Every entry of the open files
+ * table carries a buffer of this size. The amount of data actually read ahead
+ * is configured per mount point in @ref vfs_mount_t::readahead.
+ */
+#define CONFIG_VFS_READAHEAD_SIZE (64)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -348,6 +370,7 @@ extern "C" {
     _mount_mtd_ ## idx = {                          \
         .fs = &type ## _file_system,                \
         .mount_point = path,                        \
+        .readahead = CONFIG_VFS_READAHEAD_SIZE,     \
         .private_data = &fs_desc_ ## idx,           \
     }
 
@@ -402,9 +425,19 @@ struct vfs_mount_struct {
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
     uint16_t open_files;         /**< Number of currently open files and directories */
+    uint16_t readahead;          /**< Bytes to read ahead for files opened read-only,
+                                      0 to disable (only used with `vfs_readahead`) */
     void *private_data;          /**< File system driver private data, implementation defined */
 };
 
+/**
+ * @brief Read-ahead statistics
+ */
+typedef struct {
+    uint32_t hits;      /**< reads served from the read-ahead buffer alone */
+    uint32_t misses;    /**< reads that had to call into the file system driver */
+} vfs_readahead_stats_t;
+
 /**
  * @brief Information about an open file
  *
@@ -416,6 +449,14 @@ typedef struct {
     int flags;                  /**< File flags */
     off_t pos;                  /**< Current position in the file */
     kernel_pid_t pid;           /**< PID of the process that opened the file */
+#if defined(MODULE_VFS_READAHEAD) || defined(DOXYGEN)
+    struct {
+        uint16_t pos;           /**< Read position in buf */
+        uint16_t len;           /**< Number of valid bytes in buf */
+        vfs_readahead_stats_t stats;            /**< Read-ahead statistics */
+        uint8_t buf[CONFIG_VFS_READAHEAD_SIZE]; /**< Data read ahead */
+    } ra;                       /**< Read-ahead state */
+#endif
     union {
         void *ptr;              /**< pointer to private data */
         int value;              /**< alternatively, you can use private_data as an int */
@@ -867,11 +908,28 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Read bytes from an open file into an iolist
+ *
+ * The snips of @p iolist are filled in order. Reading stops early when the
+ * end of the file is reached.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] iolist   iolist to read into
+ *
+ * @return number of bytes read on success
+ * @return <0 on error
+ */
+ssize_t vfs_read_iol(int fd, const iolist_t *iolist);
+
 /**
  * @brief Read a line from an open text file
  *
  * Reads from a file until a `\r` or `\n` character is found.
  *
+ * The file is read byte by byte, use the `vfs_readahead` module to serve
+ * these reads from RAM.
+ *
  * @param[in]  fd       fd number obtained from vfs_open
  * @param[out] dest     destination buffer to hold the line
  * @param[in]  count    maximum number of characters to read
@@ -1206,6 +1264,26 @@ bool vfs_iterate_mount_dirs(vfs_DIR *dir);
  */
 const vfs_file_t *vfs_file_get(int fd);
 
+/**
+ * @brief   Get the read-ahead statistics
+ *
+ * Read-ahead is enabled by the `vfs_readahead` module for files opened with
+ * `O_RDONLY` on mount points with a non-zero @ref vfs_mount_t::readahead.
+ * Small reads are then served from a per file buffer that is refilled with
+ * a single read from the file system driver.
+ *
+ * @note    The buffered data is not invalidated by writes through other file
+ *          descriptors of the same file.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open, or @ref VFS_ANY_FD
+ *                      for the sum over all files since boot
+ * @param[out] stats    statistics
+ *
+ * @return 0 on success
+ * @return <0 on error
+ */
+int vfs_readahead_stats(int fd, vfs_readahead_stats_t *stats);
+
 /** @brief  Implementation of `stat` using `fstat`
  *
  * This helper can be used by file system drivers that do not have any more
@@ -155,10 +155,10 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For clocks that are expected to hold many active timers (e.g., hundreds of
+ * network protocol timeouts on ZTIMER_MSEC), the list can be exchanged
+ * per clock for a pairing heap by using the `ztimer_heap` module and calling
+ * @ref ztimer_heap_enable() on that clock (see @ref sys_ztimer_heap).
  *
  *
  * ## Clock extension
@@ -300,6 +300,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child in the timer heap */
+    ztimer_base_t *prev;        /**< parent or left sibling in the timer heap */
+#endif
 };
 
 /**
@@ -390,8 +394,53 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    bool heap;                      /**< timers are kept in a pairing heap  */
+    uint32_t heap_epoch;            /**< reference time for heap ordering   */
+#endif
 };
 
+/**
+ * @defgroup    sys_ztimer_heap ztimer pairing heap timer queue
+ * @ingroup     sys_ztimer
+ * @brief       Logarithmic time timer queue for ztimer clocks
+ *
+ * By default, every ztimer clock keeps its timers in a sorted, delta encoded
+ * singly linked list. Setting and removing a timer thus walks that list with
+ * interrupts disabled, which becomes the dominating source of interrupt
+ * latency once a clock holds many active timers.
+ *
+ * With the `ztimer_heap` module, a clock can instead keep its timers in a
+ * pairing heap ordered by absolute target time, resulting in:
+ *
+ * - O(1) ztimer_set() (insertion)
+ * - O(log n) amortized ztimer_remove() and expiry
+ * - O(1) get_min() (important for timer triggering)
+ * - two additional pointers per timer object (for all clocks)
+ *
+ * The heap is selected per clock by calling @ref ztimer_heap_enable().
+ * ZTIMER_USEC, ZTIMER_MSEC and ZTIMER_SEC are
+ * switched during ztimer_init() according to @ref CONFIG_ZTIMER_USEC_HEAP,
+ * @ref CONFIG_ZTIMER_MSEC_HEAP and @ref CONFIG_ZTIMER_SEC_HEAP.
+ *
+ * The API and the semantics of @ref ztimer_handler() are the same for both
+ * timer queues. The only observable difference is that timers which are
+ * already overdue (e.g., because interrupts were disabled for a long time)
+ * when a timer with a timeout close to `UINT32_MAX` is set may trigger in any
+ * order among themselves.
+ * @{
+ */
+
+/**
+ * @brief   Switch @p clock to keep its timers in a pairing heap
+ *
+ * Timers already set on @p clock are moved over to the heap.
+ *
+ * @param[in]   clock   ztimer clock to switch
+ */
+void ztimer_heap_enable(ztimer_clock_t *clock);
+/** @} */
+
 /**
  * @brief   main ztimer callback handler
  *
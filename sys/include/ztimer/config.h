@@ -187,6 +187,27 @@ extern "C" {
 #define CONFIG_ZTIMER_USEC_ADJUST_SLEEP   0
 #endif
 
+/**
+ * @brief   Use a pairing heap for ZTIMER_USEC if `ztimer_heap` is used
+ */
+#ifndef CONFIG_ZTIMER_USEC_HEAP
+#define CONFIG_ZTIMER_USEC_HEAP     1
+#endif
+
+/**
+ * @brief   Use a pairing heap for ZTIMER_MSEC if `ztimer_heap` is used
+ */
+#ifndef CONFIG_ZTIMER_MSEC_HEAP
+#define CONFIG_ZTIMER_MSEC_HEAP     1
+#endif
+
+/**
+ * @brief   Use a pairing heap for ZTIMER_SEC if `ztimer_heap` is used
+ */
+#ifndef CONFIG_ZTIMER_SEC_HEAP
+#define CONFIG_ZTIMER_SEC_HEAP      1
+#endif
+
 /**
  * @brief   Some MCUs clocks need some warm-up time during which timing is
  *          inaccurate. This can be a hindrance when using the @ref
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 
 #include "event.h"
+#include "mutex.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
 #include "uri_parser.h"
@@ -45,6 +46,8 @@ extern void gcoap_forward_proxy_post_event(void *arg);
 
 static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+/* with module gcoap_workers, requests are forwarded by several threads */
+static mutex_t _lock = MUTEX_INIT;
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -145,7 +148,9 @@ static ssize_t _forward_proxy_handler(coap_pkt_t *pdu, uint8_t *buf,
     const sock_udp_ep_t *remote = coap_request_ctx_get_remote_udp(ctx);
     const sock_udp_ep_t *local = coap_request_ctx_get_local_udp(ctx);
 
+    mutex_lock(&_lock);
     pdu_len = gcoap_forward_proxy_request_process(pdu, remote, local);
+    mutex_unlock(&_lock);
 
     /* Out of memory, reply with 5.00 */
     if (pdu_len == -ENOMEM) {
@@ -490,10 +495,10 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
     ssize_t optlen = 0;
 
     client_ep_t *cep = _allocate_client_ep(client);
-    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
     if (!cep) {
         return -ENOMEM;
     }
+    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
 
     cep->mid = coap_get_id(pkt);
     _cep_set_response_type(
@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "assert.h"
+#include "clist.h"
 #include "net/coap.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
@@ -170,6 +171,480 @@ static event_timeout_t _dtls_session_free_up_tmout;
 static event_callback_t _dtls_session_free_up_tmout_cb;
 #endif
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+static_assert(4 * CONFIG_GCOAP_REQ_WAITING_MAX <= 3 * CONFIG_GCOAP_REQ_INDEX_SIZE,
+              "CONFIG_GCOAP_REQ_INDEX_SIZE too small");
+static_assert(4 * CONFIG_GCOAP_OBS_REGISTRATIONS_MAX <= 3 * CONFIG_GCOAP_OBS_INDEX_SIZE,
+              "CONFIG_GCOAP_OBS_INDEX_SIZE too small");
+
+#if (CONFIG_GCOAP_REQ_WAITING_MAX < UINT8_MAX) && \
+    (CONFIG_GCOAP_OBS_CLIENTS_MAX < UINT8_MAX) && \
+    (CONFIG_GCOAP_OBS_REGISTRATIONS_MAX < UINT8_MAX)
+typedef uint8_t _index_slot_t;
+#else
+typedef uint16_t _index_slot_t;
+#endif
+
+/* Open-addressing hash index (linear probing) over one of the tables in
+ * _coap_state. A slot holds 1 + the position of an entry in the table, or 0
+ * if it is unused. Entries are dropped all over this file by just marking
+ * them unused, so slots may go stale: lookups verify the entry, and
+ * insertion reuses slots of unused entries. Once more than 3/4 of the slots
+ * are taken, the index is rebuilt to purge stale slots.
+ *
+ * Indexes are only modified with _coap_state.lock held. */
+typedef struct {
+    _index_slot_t *slots;
+    unsigned size;
+    unsigned used;                      /* number of non-zero slots */
+} _index_t;
+
+static _index_slot_t _req_tkn_slots[CONFIG_GCOAP_REQ_INDEX_SIZE];
+static _index_slot_t _req_mid_slots[CONFIG_GCOAP_REQ_INDEX_SIZE];
+static _index_slot_t _obs_tkn_slots[CONFIG_GCOAP_OBS_INDEX_SIZE];
+static _index_slot_t _obs_res_slots[CONFIG_GCOAP_OBS_INDEX_SIZE];
+static _index_slot_t _observer_slots[CONFIG_GCOAP_OBS_INDEX_SIZE];
+
+/* open requests by token and by message ID */
+static _index_t _req_tkn_index = { _req_tkn_slots, ARRAY_SIZE(_req_tkn_slots), 0 };
+static _index_t _req_mid_index = { _req_mid_slots, ARRAY_SIZE(_req_mid_slots), 0 };
+/* observe registrations by token and by resource */
+static _index_t _obs_tkn_index = { _obs_tkn_slots, ARRAY_SIZE(_obs_tkn_slots), 0 };
+static _index_t _obs_res_index = { _obs_res_slots, ARRAY_SIZE(_obs_res_slots), 0 };
+/* observers by endpoint; there are never more observers in use than
+ * registrations */
+static _index_t _observer_index = { _observer_slots, ARRAY_SIZE(_observer_slots), 0 };
+
+/* Resources of all listeners using the default request matcher, hashed by
+ * path. Resources are never removed, so there are no stale slots. If a
+ * resource does not fit, the index is given up on and the listeners are
+ * searched linearly again. */
+static const coap_resource_t *_res_index[CONFIG_GCOAP_RESOURCE_INDEX_SIZE];
+static unsigned _res_index_used;
+static unsigned _res_index_subtrees;    /* number of COAP_MATCH_SUBTREE resources */
+static bool _res_index_overflow;
+
+#define FNV1A_BASIS     (2166136261U)
+
+static inline uint32_t _fnv1a_step(uint32_t hash, uint8_t c)
+{
+    return (hash ^ c) * 16777619U;
+}
+
+static uint32_t _fnv1a(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = _fnv1a_step(hash, bytes[i]);
+    }
+    return hash;
+}
+
+static uint32_t _ep_hash(const sock_udp_ep_t *ep)
+{
+    /* covers exactly what sock_udp_ep_equal() compares */
+    uint32_t hash = _fnv1a(FNV1A_BASIS, &ep->family, sizeof(ep->family));
+
+    hash = _fnv1a(hash, &ep->port, sizeof(ep->port));
+    switch (ep->family) {
+#ifdef SOCK_HAS_IPV4
+    case AF_INET:
+        return _fnv1a(hash, ep->addr.ipv4, sizeof(ep->addr.ipv4));
+#endif
+#ifdef SOCK_HAS_IPV6
+    case AF_INET6:
+        return _fnv1a(hash, ep->addr.ipv6, sizeof(ep->addr.ipv6));
+#endif
+    default:
+        return hash;
+    }
+}
+
+/* Returns the first slot on the probe sequence of @p hash, iterate with
+ * _index_next() until the slot is 0 */
+static inline unsigned _index_first(const _index_t *index, uint32_t hash)
+{
+    return hash % index->size;
+}
+
+static inline unsigned _index_next(const _index_t *index, unsigned slot)
+{
+    return (slot + 1) % index->size;
+}
+
+/* Puts @p pos into the probe sequence of @p hash. Returns false if the index
+ * needs to be rebuilt first. */
+static bool _index_add(_index_t *index, uint32_t hash, unsigned pos,
+                       bool (*unused)(unsigned pos))
+{
+    unsigned slot = _index_first(index, hash);
+
+    for (unsigned i = 0; i < index->size; i++) {
+        unsigned cur = index->slots[slot];
+
+        if (cur == 0) {
+            if (4 * (index->used + 1) > 3 * index->size) {
+                return false;
+            }
+            index->used++;
+            index->slots[slot] = pos + 1;
+            return true;
+        }
+        if ((cur == pos + 1) || unused(cur - 1)) {
+            index->slots[slot] = pos + 1;
+            return true;
+        }
+        slot = _index_next(index, slot);
+    }
+    return false;
+}
+
+static void _index_clear(_index_t *index)
+{
+    memset(index->slots, 0, index->size * sizeof(index->slots[0]));
+    index->used = 0;
+}
+
+static uint32_t _req_tkn_hash(const uint8_t *token, size_t tkl)
+{
+    return _fnv1a(FNV1A_BASIS, token, tkl);
+}
+
+static uint32_t _req_mid_hash(uint16_t mid)
+{
+    return _fnv1a(FNV1A_BASIS, &mid, sizeof(mid));
+}
+
+static bool _req_unused(unsigned pos)
+{
+    return _coap_state.open_reqs[pos].state == GCOAP_MEMO_UNUSED;
+}
+
+static bool _req_index_add_unlocked(gcoap_request_memo_t *memo)
+{
+    const unsigned pos = memo - _coap_state.open_reqs;
+    const coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+
+    return _index_add(&_req_tkn_index,
+                      _req_tkn_hash(coap_hdr_get_token(hdr),
+                                    coap_hdr_get_token_len(hdr)),
+                      pos, _req_unused) &&
+           _index_add(&_req_mid_index, _req_mid_hash(hdr->id), pos,
+                      _req_unused);
+}
+
+/* Indexes a newly sent request. Must be called with _coap_state.lock held. */
+static void _req_index_add(gcoap_request_memo_t *memo)
+{
+    if (_req_index_add_unlocked(memo)) {
+        return;
+    }
+    _index_clear(&_req_tkn_index);
+    _index_clear(&_req_mid_index);
+    for (unsigned i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        if (!_req_unused(i)) {
+            /* can't fail: at most 3/4 of the slots are needed */
+            _req_index_add_unlocked(&_coap_state.open_reqs[i]);
+        }
+    }
+}
+
+static uint32_t _obs_res_hash(const coap_resource_t *resource)
+{
+    return _fnv1a(FNV1A_BASIS, &resource, sizeof(resource));
+}
+
+static bool _obs_unused(unsigned pos)
+{
+    return _coap_state.observe_memos[pos].observer == NULL;
+}
+
+static bool _observer_unused(unsigned pos)
+{
+    return _coap_state.observers[pos].family == AF_UNSPEC;
+}
+
+static bool _obs_index_add_unlocked(gcoap_observe_memo_t *memo)
+{
+    const unsigned pos = memo - _coap_state.observe_memos;
+    const unsigned observer = memo->observer - _coap_state.observers;
+
+    return _index_add(&_obs_tkn_index,
+                      _req_tkn_hash(memo->token, memo->token_len),
+                      pos, _obs_unused) &&
+           _index_add(&_obs_res_index, _obs_res_hash(memo->resource), pos,
+                      _obs_unused) &&
+           _index_add(&_observer_index, _ep_hash(memo->observer), observer,
+                      _observer_unused);
+}
+
+/* Indexes a new or updated observe registration along with its observer.
+ * Must be called with _coap_state.lock held. */
+static void _obs_index_add(gcoap_observe_memo_t *memo)
+{
+    if (_obs_index_add_unlocked(memo)) {
+        return;
+    }
+    _index_clear(&_obs_tkn_index);
+    _index_clear(&_obs_res_index);
+    _index_clear(&_observer_index);
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        if (!_obs_unused(i)) {
+            /* can't fail: at most 3/4 of the slots are needed */
+            _obs_index_add_unlocked(&_coap_state.observe_memos[i]);
+        }
+    }
+}
+
+static void _res_index_add(const gcoap_listener_t *listener)
+{
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        const coap_resource_t *resource = &listener->resources[i];
+        unsigned slot = _fnv1a(FNV1A_BASIS, resource->path,
+                               strlen(resource->path)) % ARRAY_SIZE(_res_index);
+
+        while (_res_index[slot] && (_res_index[slot] != resource)) {
+            slot = (slot + 1) % ARRAY_SIZE(_res_index);
+        }
+        if (_res_index[slot]) {
+            /* resource array shared with another listener */
+            continue;
+        }
+        if (4 * (_res_index_used + 1) > 3 * ARRAY_SIZE(_res_index)) {
+            DEBUG("gcoap: resource index full\n");
+            _res_index_overflow = true;
+            return;
+        }
+        if (resource->methods & COAP_MATCH_SUBTREE) {
+            _res_index_subtrees++;
+        }
+        _res_index_used++;
+        _res_index[slot] = resource;
+    }
+}
+
+/* Same as matching the path of every resource of @p listener in order, see
+ * _request_matcher_default() */
+static int _res_index_match(const gcoap_listener_t *listener,
+                            const char *uri, coap_method_flags_t method_flag,
+                            const coap_resource_t **resource)
+{
+    const coap_resource_t *first = listener->resources;
+    const coap_resource_t *last = first + listener->resources_len;
+    const size_t uri_len = strlen(uri);
+    uint32_t hash = FNV1A_BASIS;
+    int ret = GCOAP_RESOURCE_NO_PATH;
+
+    *resource = NULL;
+    /* a subtree resource matches if its path is a prefix of uri, so probe
+     * for every prefix if there are any */
+    for (size_t len = 0; len <= uri_len; len++) {
+        if ((len < uri_len) && (_res_index_subtrees == 0)) {
+            hash = _fnv1a_step(hash, uri[len]);
+            continue;
+        }
+
+        unsigned slot = hash % ARRAY_SIZE(_res_index);
+
+        for (const coap_resource_t *r; (r = _res_index[slot]) != NULL;
+             slot = (slot + 1) % ARRAY_SIZE(_res_index)) {
+            if ((r < first) || (r >= last) ||
+                (!(r->methods & COAP_MATCH_SUBTREE) && (len < uri_len)) ||
+                (strlen(r->path) != len) || memcmp(r->path, uri, len)) {
+                continue;
+            }
+            if (!(r->methods & method_flag)) {
+                ret = GCOAP_RESOURCE_WRONG_METHOD;
+            }
+            /* the first matching resource of the listener wins */
+            else if ((*resource == NULL) || (r < *resource)) {
+                *resource = r;
+            }
+        }
+        if (len < uri_len) {
+            hash = _fnv1a_step(hash, uri[len]);
+        }
+    }
+    return (*resource) ? GCOAP_RESOURCE_FOUND : ret;
+}
+#else
+static inline void _req_index_add(gcoap_request_memo_t *memo)
+{
+    (void)memo;
+}
+
+static inline void _obs_index_add(gcoap_observe_memo_t *memo)
+{
+    (void)memo;
+}
+
+static inline void _res_index_add(const gcoap_listener_t *listener)
+{
+    (void)listener;
+}
+#endif
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/* A received request waiting for or being handled by a worker */
+typedef struct {
+    clist_node_t node;                  /* in _jobs_free or _jobs_pending */
+    gcoap_socket_t socket;
+    sock_udp_ep_t remote;
+    sock_udp_aux_tx_t aux;
+    bool has_aux;                       /* false for multicast requests */
+    size_t len;
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+} _worker_job_t;
+
+typedef struct {
+    event_queue_t queue;
+    event_t event;                      /* posted when jobs are pending */
+    bool idle;                          /* event not posted, nor running */
+} _worker_t;
+
+static _worker_job_t _jobs[CONFIG_GCOAP_WORKER_JOBS];
+static _worker_t _workers[CONFIG_GCOAP_WORKERS_NUMOF];
+static char _worker_stacks[CONFIG_GCOAP_WORKERS_NUMOF][GCOAP_WORKER_STACK_SIZE];
+
+/* Protects the job lists and the idle flags of the workers */
+static mutex_t _jobs_lock = MUTEX_INIT;
+static clist_node_t _jobs_free;
+static clist_node_t _jobs_pending;
+
+static void _worker_handle(_worker_job_t *job)
+{
+    coap_pkt_t pdu;
+
+    /* was parsed by the gcoap thread already */
+    if (coap_parse_udp(&pdu, job->buf, job->len) < 0) {
+        return;
+    }
+
+    sock_udp_aux_tx_t *aux = job->has_aux ? &job->aux : NULL;
+    size_t pdu_len = _handle_req(&job->socket, &pdu, job->buf, sizeof(job->buf),
+                                 &job->remote, aux);
+
+    if (pdu_len > 0) {
+        ssize_t bytes = _tl_send(&job->socket, job->buf, pdu_len, &job->remote, aux);
+        if (bytes <= 0) {
+            DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
+        }
+    }
+}
+
+/* Handles pending jobs until there are none left */
+static void _worker_run(event_t *event)
+{
+    _worker_t *worker = container_of(event, _worker_t, event);
+    _worker_job_t *job = NULL;
+
+    while (1) {
+        mutex_lock(&_jobs_lock);
+        if (job) {
+            clist_rpush(&_jobs_free, &job->node);
+        }
+        job = (_worker_job_t *)clist_lpop(&_jobs_pending);
+        if (job == NULL) {
+            worker->idle = true;
+            mutex_unlock(&_jobs_lock);
+            return;
+        }
+        mutex_unlock(&_jobs_lock);
+
+        _worker_handle(job);
+    }
+}
+
+static void *_worker_thread(void *arg)
+{
+    _worker_t *worker = arg;
+
+    event_queue_claim(&worker->queue);
+    event_loop(&worker->queue);
+    return NULL;
+}
+
+static void _workers_init(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_jobs); i++) {
+        clist_rpush(&_jobs_free, &_jobs[i].node);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_workers); i++) {
+        _worker_t *worker = &_workers[i];
+
+        /* jobs may be posted before the worker runs */
+        event_queue_init_detached(&worker->queue);
+        worker->event.handler = _worker_run;
+        worker->idle = true;
+        thread_create(_worker_stacks[i], sizeof(_worker_stacks[i]),
+                      GCOAP_WORKER_PRIO, 0, _worker_thread, worker,
+                      "gcoap worker");
+    }
+}
+
+/*
+ * Queues a request for the workers.
+ *
+ * return 0 if queued, -ENOMEM if no job is free, -ENOTSUP if the request must
+ * be handled by the gcoap thread
+ */
+static int _worker_dispatch(gcoap_socket_t *sock, sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux, const uint8_t *buf, size_t len)
+{
+    /* DTLS sessions are only handled by the gcoap thread */
+    if (sock->type != GCOAP_SOCKET_TYPE_UDP) {
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&_jobs_lock);
+    _worker_job_t *job = (_worker_job_t *)clist_lpop(&_jobs_free);
+    mutex_unlock(&_jobs_lock);
+    if (job == NULL) {
+        DEBUG_PUTS("gcoap: no free worker job");
+        return -ENOMEM;
+    }
+
+    assert(len <= sizeof(job->buf));
+    memcpy(job->buf, buf, len);
+    job->len = len;
+    job->socket = *sock;
+    job->remote = *remote;
+    job->has_aux = (aux != NULL);
+    if (aux) {
+        job->aux = *aux;
+    }
+
+    mutex_lock(&_jobs_lock);
+    clist_rpush(&_jobs_pending, &job->node);
+    for (unsigned i = 0; i < ARRAY_SIZE(_workers); i++) {
+        if (_workers[i].idle) {
+            _workers[i].idle = false;
+            event_post(&_workers[i].queue, &_workers[i].event);
+            break;
+        }
+    }
+    mutex_unlock(&_jobs_lock);
+    return 0;
+}
+#else
+static inline void _workers_init(void)
+{
+}
+
+static inline int _worker_dispatch(gcoap_socket_t *sock, sock_udp_ep_t *remote,
+                                   sock_udp_aux_tx_t *aux, const uint8_t *buf,
+                                   size_t len)
+{
+    (void)sock;
+    (void)remote;
+    (void)aux;
+    (void)buf;
+    (void)len;
+    return -ENOTSUP;
+}
+#endif
+
 /* Event loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
 {
@@ -444,7 +919,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 
         /* check if this RST is due to the client not being interested
          * in receiving observe notifications anymore. */
+        mutex_lock(&_coap_state.lock);
         _check_and_expire_obs_memo_last_mid(remote, coap_get_id(&pdu));
+        mutex_unlock(&_coap_state.lock);
     }
 
     /* validate class and type for incoming */
@@ -478,6 +955,12 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                 /* TBD: Set a Size1 */
                 pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
                                          COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
+            } else if ((res = _worker_dispatch(sock, remote, aux, buf, len)) == 0) {
+                /* the worker sends the response */
+                pdu_len = 0;
+            } else if (res == -ENOMEM) {
+                pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
+                                         COAP_CODE_SERVICE_UNAVAILABLE);
             } else {
                 pdu_len = _handle_req(sock, &pdu, _listen_buf,
                                       sizeof(_listen_buf), remote, aux);
@@ -687,8 +1170,6 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -696,6 +1177,12 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             break;
     }
 
+    /* registrations are also changed by other workers and read by
+     * gcoap_obs_init() */
+    mutex_lock(&_coap_state.lock);
+    /* find observe registration for resource */
+    _find_obs_memo_resource(&resource_memo, resource);
+
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, NULL, pdu);
@@ -759,6 +1246,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             if (memo->token_len) {
                 memcpy(&memo->token[0], coap_get_token(pdu), memo->token_len);
             }
+            _obs_index_add(memo);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -786,10 +1274,12 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         coap_clear_observe(pdu);
 
     } else if (coap_has_observe(pdu)) {
+        mutex_unlock(&_coap_state.lock);
         /* bogus request; don't respond */
         DEBUG("gcoap: Observe value unexpected: %" PRIu32 "\n", coap_get_observe(pdu));
         return -1;
     }
+    mutex_unlock(&_coap_state.lock);
 
     ssize_t pdu_len;
 
@@ -847,6 +1337,12 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     coap_method_flags_t method_flag = coap_method2flag(
         coap_get_code_detail(pdu));
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+    if (!_res_index_overflow) {
+        return _res_index_match(listener, (char *)uri, method_flag, resource);
+    }
+#endif
+
     *resource = NULL;
     while ((*resource = _match_resource_path_iterator(listener, *resource, uri))) {
         /* potential match, check for method */
@@ -927,6 +1423,63 @@ static int _find_resource(gcoap_socket_type_t tl_type,
     return ret;
 }
 
+static bool _req_memo_match_token(const gcoap_request_memo_t *memo,
+                                  const sock_udp_ep_t *remote,
+                                  const uint8_t *token, size_t tkl)
+{
+    if (memo->state == GCOAP_MEMO_UNUSED) {
+        return false;
+    }
+
+    coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+
+    /* verbose debug to catch bugs with request/response matching */
+#if SOCK_HAS_IPV4
+    DEBUG("Seeking memo for remote=%s, tkn=0x%02x%02x%02x%02x%02x%02x%02x%02x, tkl=%"PRIuSIZE"\n",
+          ipv4_addr_to_str(_ipv6_addr_str, (ipv4_addr_t *)&remote->addr.ipv4,
+                           IPV6_ADDR_MAX_STR_LEN),
+          token[0], token[1], token[2], token[3], token[4], token[5], token[6], token[7],
+          tkl);
+#else
+    DEBUG("Seeking memo for remote=%s, tkn=0x%02x%02x%02x%02x%02x%02x%02x%02x, tkl=%"PRIuSIZE"\n",
+          ipv6_addr_to_str(_ipv6_addr_str, (ipv6_addr_t *)&remote->addr.ipv6,
+                           IPV6_ADDR_MAX_STR_LEN),
+          token[0], token[1], token[2], token[3], token[4], token[5], token[6], token[7],
+          tkl);
+#endif
+
+    size_t memo_tkl = coap_hdr_get_token_len(hdr);
+    if (memo_tkl != tkl) {
+        DEBUG("Token length mismatch %" PRIuSIZE "\n", memo_tkl);
+        return false;
+    }
+    const uint8_t *memo_token = coap_hdr_get_token(hdr);
+    if (memcmp(token, memo_token, tkl)) {
+        DEBUG("Token mismatch 0x%02x%02x%02x%02x%02x%02x%02x%02x\n",
+              memo_token[0], memo_token[1], memo_token[2], memo_token[3],
+              memo_token[4], memo_token[5], memo_token[6], memo_token[7]);
+        return false;
+    }
+    if (!sock_udp_ep_equal(&memo->remote_ep, remote)) {
+        if (sock_udp_ep_is_multicast(&memo->remote_ep)) {
+            DEBUG("matching multicast response\n");
+        }
+        else {
+#if SOCK_HAS_IPV4
+            DEBUG("Remote address mismatch %s\n",
+                  ipv4_addr_to_str(_ipv6_addr_str, (ipv4_addr_t *)&memo->remote_ep.addr.ipv4,
+                                   IPV6_ADDR_MAX_STR_LEN));
+#else
+            DEBUG("Remote address mismatch %s\n",
+                  ipv6_addr_to_str(_ipv6_addr_str, (ipv6_addr_t *)&memo->remote_ep.addr.ipv6,
+                                   IPV6_ADDR_MAX_STR_LEN));
+#endif
+            return false;
+        }
+    }
+    return true;
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -940,60 +1493,30 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
                                                      const uint8_t *token, size_t tkl)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
+#if IS_USED(MODULE_GCOAP_INDEX)
+    unsigned slot = _index_first(&_req_tkn_index, _req_tkn_hash(token, tkl));
 
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-        coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    for (unsigned i = 0; i < _req_tkn_index.size; i++) {
+        if (_req_tkn_index.slots[slot] == 0) {
+            break;
+        }
 
-        /* verbose debug to catch bugs with request/response matching */
-#if SOCK_HAS_IPV4
-        DEBUG("Seeking memo for remote=%s, tkn=0x%02x%02x%02x%02x%02x%02x%02x%02x, tkl=%"PRIuSIZE"\n",
-              ipv4_addr_to_str(_ipv6_addr_str, (ipv4_addr_t *)&remote->addr.ipv4,
-                               IPV6_ADDR_MAX_STR_LEN),
-              token[0], token[1], token[2], token[3], token[4], token[5], token[6], token[7],
-              tkl);
-#else
-        DEBUG("Seeking memo for remote=%s, tkn=0x%02x%02x%02x%02x%02x%02x%02x%02x, tkl=%"PRIuSIZE"\n",
-              ipv6_addr_to_str(_ipv6_addr_str, (ipv6_addr_t *)&remote->addr.ipv6,
-                               IPV6_ADDR_MAX_STR_LEN),
-              token[0], token[1], token[2], token[3], token[4], token[5], token[6], token[7],
-              tkl);
-#endif
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[_req_tkn_index.slots[slot] - 1];
 
-        size_t memo_tkl = coap_hdr_get_token_len(hdr);
-        if (memo_tkl != tkl) {
-            DEBUG("Token length mismatch %" PRIuSIZE "\n", memo_tkl);
-            continue;
-        }
-        const uint8_t *memo_token = coap_hdr_get_token(hdr);
-        if (memcmp(token, memo_token, tkl)) {
-            DEBUG("Token mismatch 0x%02x%02x%02x%02x%02x%02x%02x%02x\n",
-                  memo_token[0], memo_token[1], memo_token[2], memo_token[3],
-                  memo_token[4], memo_token[5], memo_token[6], memo_token[7]);
-            continue;
+        if (_req_memo_match_token(memo, remote, token, tkl)) {
+            return memo;
         }
-        if (!sock_udp_ep_equal(&memo->remote_ep, remote)) {
-            if (sock_udp_ep_is_multicast(&memo->remote_ep)) {
-                DEBUG("matching multicast response\n");
-            }
-            else {
-#if SOCK_HAS_IPV4
-                DEBUG("Remote address mismatch %s\n",
-                      ipv4_addr_to_str(_ipv6_addr_str, (ipv4_addr_t *)&memo->remote_ep.addr.ipv4,
-                                       IPV6_ADDR_MAX_STR_LEN));
+        slot = _index_next(&_req_tkn_index, slot);
+    }
 #else
-                DEBUG("Remote address mismatch %s\n",
-                      ipv6_addr_to_str(_ipv6_addr_str, (ipv6_addr_t *)&memo->remote_ep.addr.ipv6,
-                                       IPV6_ADDR_MAX_STR_LEN));
-#endif
-                continue;
-            }
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+        if (_req_memo_match_token(memo, remote, token, tkl)) {
+            return memo;
         }
-        return memo;
     }
+#endif
     return NULL;
 }
 
@@ -1013,9 +1536,25 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
 {
     unsigned tkl = coap_get_token_len(src_pdu);
     uint8_t *token = coap_get_token(src_pdu);
+
+    if (IS_USED(MODULE_GCOAP_INDEX)) {
+        /* index may be rebuilt by gcoap_req_send() in another thread */
+        mutex_lock(&_coap_state.lock);
+        gcoap_request_memo_t *memo = _find_req_memo_by_token(remote, token, tkl);
+        mutex_unlock(&_coap_state.lock);
+        return memo;
+    }
     return _find_req_memo_by_token(remote, token, tkl);
 }
 
+static bool _req_memo_match_mid(const gcoap_request_memo_t *memo,
+                                const sock_udp_ep_t *remote, uint16_t mid)
+{
+    return (memo->state != GCOAP_MEMO_UNUSED) &&
+           (mid == gcoap_request_memo_get_hdr(memo)->id) &&
+           sock_udp_ep_equal(&memo->remote_ep, remote);
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and message ID.
@@ -1029,19 +1568,35 @@ static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
 {
     /* mid is in network byte order */
     uint16_t mid = coap_get_udp_hdr_const(pkt)->id;
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
+    gcoap_request_memo_t *memo = NULL;
 
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+#if IS_USED(MODULE_GCOAP_INDEX)
+    /* index may be rebuilt by gcoap_req_send() in another thread */
+    mutex_lock(&_coap_state.lock);
 
-        if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
-            sock_udp_ep_equal(&memo->remote_ep, remote)) {
-            return memo;
+    unsigned slot = _index_first(&_req_mid_index, _req_mid_hash(mid));
+
+    for (unsigned i = 0; i < _req_mid_index.size; i++) {
+        if (_req_mid_index.slots[slot] == 0) {
+            break;
+        }
+        if (_req_memo_match_mid(&_coap_state.open_reqs[_req_mid_index.slots[slot] - 1],
+                                remote, mid)) {
+            memo = &_coap_state.open_reqs[_req_mid_index.slots[slot] - 1];
+            break;
         }
+        slot = _index_next(&_req_mid_index, slot);
     }
-    return NULL;
+    mutex_unlock(&_coap_state.lock);
+#else
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        if (_req_memo_match_mid(&_coap_state.open_reqs[i], remote, mid)) {
+            memo = &_coap_state.open_reqs[i];
+            break;
+        }
+    }
+#endif
+    return memo;
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -1116,6 +1671,25 @@ static int _find_endpoint(sock_udp_ep_t **out, sock_udp_ep_t *in, unsigned max)
 
 static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 {
+#if IS_USED(MODULE_GCOAP_INDEX)
+    unsigned slot = _index_first(&_observer_index, _ep_hash(remote));
+
+    for (unsigned i = 0; i < _observer_index.size; i++) {
+        if (_observer_index.slots[slot] == 0) {
+            break;
+        }
+
+        sock_udp_ep_t *ep = &_coap_state.observers[_observer_index.slots[slot] - 1];
+
+        /* unused observers never match as their family is AF_UNSPEC */
+        if (sock_udp_ep_equal(ep, remote)) {
+            *observer = ep;
+            return -1;
+        }
+        slot = _index_next(&_observer_index, slot);
+    }
+    /* only an empty slot is left to find */
+#endif
     *observer = _coap_state.observers;
     return _find_endpoint(observer, remote, CONFIG_GCOAP_OBS_CLIENTS_MAX);
 }
@@ -1126,6 +1700,25 @@ static int _find_notifier(sock_udp_ep_t **notifier, sock_udp_ep_t *local)
     return _find_endpoint(notifier, local, CONFIG_GCOAP_OBS_NOTIFIERS_MAX);
 }
 
+static bool _obs_memo_match(const gcoap_observe_memo_t *memo,
+                            const sock_udp_ep_t *observer,
+                            const sock_udp_ep_t *notifier,
+                            coap_pkt_t *pdu)
+{
+    if ((memo->observer == NULL) ||
+        ((memo->observer != observer) && observer) ||
+        ((memo->notifier != notifier) && notifier)) {
+        return false;
+    }
+    if (pdu == NULL) {
+        return true;
+    }
+    return (memo->token_len == coap_get_token_len(pdu))
+           && memo->token_len
+           && (memcmp(&memo->token[0], coap_get_token(pdu),
+                      memo->token_len) == 0);
+}
+
 /*
  * Find registered observe memo for a remote address and token.
  *
@@ -1152,27 +1745,42 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo,
     if (local) {
         _find_notifier(&local_notifier, local);
     }
+#if IS_USED(MODULE_GCOAP_INDEX)
+    if (pdu != NULL) {
+        unsigned slot = _index_first(&_obs_tkn_index,
+                                     _req_tkn_hash(coap_get_token(pdu),
+                                                   coap_get_token_len(pdu)));
+
+        for (unsigned i = 0; i < _obs_tkn_index.size; i++) {
+            if (_obs_tkn_index.slots[slot] == 0) {
+                break;
+            }
+            if (_obs_memo_match(&_coap_state.observe_memos[_obs_tkn_index.slots[slot] - 1],
+                                remote_observer, local_notifier, pdu)) {
+                *memo = &_coap_state.observe_memos[_obs_tkn_index.slots[slot] - 1];
+                return -1;
+            }
+            slot = _index_next(&_obs_tkn_index, slot);
+        }
+        /* only an empty slot is left to find */
+        for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+            if (_coap_state.observe_memos[i].observer == NULL) {
+                empty_slot = i;
+            }
+        }
+        return empty_slot;
+    }
+#endif
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer == NULL) {
             empty_slot = i;
             continue;
         }
 
-        if ((_coap_state.observe_memos[i].observer == remote_observer || !remote_observer) &&
-            (_coap_state.observe_memos[i].notifier == local_notifier || !local_notifier)) {
-            if (pdu == NULL) {
-                *memo = &_coap_state.observe_memos[i];
-                break;
-            }
-            unsigned memo_token_len = _coap_state.observe_memos[i].token_len;
-            if (memo_token_len == coap_get_token_len(pdu)
-                && memo_token_len
-                && memcmp(&_coap_state.observe_memos[i].token[0],
-                          coap_get_token(pdu),
-                          memo_token_len) == 0) {
-                *memo = &_coap_state.observe_memos[i];
-                break;
-            }
+        if (_obs_memo_match(&_coap_state.observe_memos[i], remote_observer,
+                            local_notifier, pdu)) {
+            *memo = &_coap_state.observe_memos[i];
+            break;
         }
     }
     return empty_slot;
@@ -1242,6 +1850,24 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
+#if IS_USED(MODULE_GCOAP_INDEX)
+    unsigned slot = _index_first(&_obs_res_index, _obs_res_hash(resource));
+
+    for (unsigned i = 0; i < _obs_res_index.size; i++) {
+        if (_obs_res_index.slots[slot] == 0) {
+            break;
+        }
+
+        gcoap_observe_memo_t *obs_memo =
+            &_coap_state.observe_memos[_obs_res_index.slots[slot] - 1];
+
+        if ((obs_memo->observer != NULL) && (obs_memo->resource == resource)) {
+            *memo = obs_memo;
+            break;
+        }
+        slot = _index_next(&_obs_res_index, slot);
+    }
+#else
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
@@ -1249,6 +1875,7 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
             break;
         }
     }
+#endif
 }
 
 /*
@@ -1607,6 +2234,7 @@ kernel_pid_t gcoap_init(void)
     if (_pid != KERNEL_PID_UNDEF) {
         return -EEXIST;
     }
+    _workers_init();
     _pid = thread_create(_msg_stack, sizeof(_msg_stack), THREAD_PRIORITY_MAIN - 1,
                             0, _event_loop, NULL, "gcoap");
 
@@ -1616,6 +2244,7 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+    _res_index_add(&_default_listener);
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -1652,6 +2281,11 @@ void gcoap_register_listener(gcoap_listener_t *listener)
      * behavior will notice this. */
     assert(listener->next == NULL);
 
+    if (!listener->request_matcher) {
+        /* index before the listener becomes visible */
+        _res_index_add(listener);
+    }
+
     listener->next = _coap_state.listeners;
     _coap_state.listeners = listener;
 
@@ -1840,6 +2474,9 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            _req_index_add(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -20,53 +20,275 @@
 
 #include <string.h>
 
+#include "bitfield.h"
 #include "kernel_defines.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+#include "byteorder.h"
+#include "hashes/siphash.h"
+#include "random.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static int _cache_replacement_lru(void);
-static int _cache_update_lru(clist_node_t *node);
+/* Entries are referenced by their position in _cache_entries */
+typedef uint16_t _pos_t;
+
+#define NIL     UINT16_MAX
+
+static_assert(CONFIG_NANOCOAP_CACHE_ENTRIES < NIL,
+              "CONFIG_NANOCOAP_CACHE_ENTRIES too large");
+
+/* Links of an entry in use, kept apart from the entries. A cached entry is
+ * in the chain of its hash bucket and in the LRU list. Until it becomes
+ * stale, it is also in the slot of the expiry wheel for the second it
+ * becomes stale in. */
+typedef struct {
+    _pos_t hash_next;
+    _pos_t lru_prev;
+    _pos_t lru_next;
+    _pos_t wheel_prev;
+    _pos_t wheel_next;
+    _pos_t wheel_slot;      /* NIL if not in the wheel */
+} _links_t;
 
-static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static _links_t _links[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static BITFIELD(_in_use, CONFIG_NANOCOAP_CACHE_ENTRIES);
+static size_t _used;
 
-static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
-static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
+static _pos_t _buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+static _pos_t _lru_head;    /* least recently used */
+static _pos_t _lru_tail;    /* most recently used */
+static _pos_t _wheel[CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS];
+static uint32_t _wheel_now; /* the second the wheel was advanced to */
 
-static int _cache_replacement_lru(void)
+static nanocoap_cache_stats_t _stats;
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+static_assert(CONFIG_NANOCOAP_CACHE_KEY_LENGTH <= SIPHASH_DIGEST_LENGTH,
+              "CONFIG_NANOCOAP_CACHE_KEY_LENGTH too large for SipHash");
+
+/* drawn on nanocoap_cache_init(), so keys are not predictable */
+static uint8_t _siphash_key[SIPHASH_KEY_LENGTH];
+#endif
+
+static inline _pos_t _pos(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    return ce - _cache_entries;
+}
 
-    /* no element in the list */
-    if (!lru_node) {
-        return -1;
+static unsigned _bucket(const uint8_t *cache_key)
+{
+    /* the key is a digest already */
+    uint32_t hash = 0;
+
+    memcpy(&hash, cache_key, MIN(sizeof(hash), CONFIG_NANOCOAP_CACHE_KEY_LENGTH));
+    return hash % CONFIG_NANOCOAP_CACHE_BUCKETS;
+}
+
+static void _hash_add(_pos_t pos)
+{
+    unsigned bucket = _bucket(_cache_entries[pos].cache_key);
+
+    _links[pos].hash_next = _buckets[bucket];
+    _buckets[bucket] = pos;
+}
+
+static void _hash_remove(_pos_t pos)
+{
+    _pos_t *prev = &_buckets[_bucket(_cache_entries[pos].cache_key)];
+
+    while (*prev != pos) {
+        assert(*prev != NIL);
+        prev = &_links[*prev].hash_next;
+    }
+    *prev = _links[pos].hash_next;
+}
+
+static nanocoap_cache_entry_t *_hash_find(const uint8_t *cache_key)
+{
+    for (_pos_t pos = _buckets[_bucket(cache_key)]; pos != NIL;
+         pos = _links[pos].hash_next) {
+        if (!memcmp(_cache_entries[pos].cache_key, cache_key,
+                    CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            return &_cache_entries[pos];
+        }
+    }
+    return NULL;
+}
+
+static void _lru_remove(_pos_t pos)
+{
+    _links_t *links = &_links[pos];
+
+    if (links->lru_prev == NIL) {
+        _lru_head = links->lru_next;
+    }
+    else {
+        _links[links->lru_prev].lru_next = links->lru_next;
+    }
+    if (links->lru_next == NIL) {
+        _lru_tail = links->lru_prev;
+    }
+    else {
+        _links[links->lru_next].lru_prev = links->lru_prev;
+    }
+}
+
+/* Adds an entry as most recently used */
+static void _lru_append(_pos_t pos)
+{
+    _links[pos].lru_prev = _lru_tail;
+    _links[pos].lru_next = NIL;
+    if (_lru_tail == NIL) {
+        _lru_head = pos;
+    }
+    else {
+        _links[_lru_tail].lru_next = pos;
+    }
+    _lru_tail = pos;
+}
+
+/* Adds an entry as least recently used, i.e. the next one to replace */
+static void _lru_prepend(_pos_t pos)
+{
+    _links[pos].lru_prev = NIL;
+    _links[pos].lru_next = _lru_head;
+    if (_lru_head == NIL) {
+        _lru_tail = pos;
+    }
+    else {
+        _links[_lru_head].lru_prev = pos;
+    }
+    _lru_head = pos;
+}
+
+static void _wheel_remove(_pos_t pos)
+{
+    _links_t *links = &_links[pos];
+
+    if (links->wheel_slot == NIL) {
+        return;
+    }
+    if (links->wheel_prev == NIL) {
+        _wheel[links->wheel_slot] = links->wheel_next;
+    }
+    else {
+        _links[links->wheel_prev].wheel_next = links->wheel_next;
+    }
+    if (links->wheel_next != NIL) {
+        _links[links->wheel_next].wheel_prev = links->wheel_prev;
+    }
+    links->wheel_slot = NIL;
+}
+
+/* Files an entry under the second it becomes stale in */
+static void _wheel_add(_pos_t pos)
+{
+    _links_t *links = &_links[pos];
+    _pos_t slot = (_cache_entries[pos].max_age + 1) % CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS;
+
+    assert(links->wheel_slot == NIL);
+    links->wheel_slot = slot;
+    links->wheel_prev = NIL;
+    links->wheel_next = _wheel[slot];
+    if (_wheel[slot] != NIL) {
+        _links[_wheel[slot]].wheel_prev = pos;
     }
+    _wheel[slot] = pos;
+}
+
+static void _wheel_update(_pos_t pos)
+{
+    _wheel_remove(pos);
+    _wheel_add(pos);
+}
+
+static bool _has_etag(nanocoap_cache_entry_t *ce)
+{
+    uint8_t *etag;
+
+    return coap_opt_get_opaque(&ce->response_pkt, COAP_OPT_ETAG, &etag) > 0;
+}
+
+static void _expire(_pos_t pos, uint32_t now)
+{
+    nanocoap_cache_entry_t *ce = &_cache_entries[pos];
+
+    if (!nanocoap_cache_entry_is_stale(ce, now)) {
+        /* Max-Age was refreshed, or is more than a revolution ahead */
+        if (_links[pos].wheel_slot !=
+            (ce->max_age + 1) % CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS) {
+            _wheel_update(pos);
+        }
+        return;
+    }
+
+    _wheel_remove(pos);
+    if (_has_etag(ce)) {
+        /* may still be validated, but is replaced first */
+        _lru_remove(pos);
+        _lru_prepend(pos);
+    }
+    else {
+        nanocoap_cache_del(ce);
+        _stats.expirations++;
+    }
+}
+
+/* Handles all wheel slots passed since the last call */
+static void _wheel_advance(void)
+{
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    uint32_t ticks = now - _wheel_now;
+
+    if (ticks > CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS) {
+        ticks = CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS;
+    }
+    for (uint32_t i = 1; i <= ticks; i++) {
+        _pos_t pos = _wheel[(_wheel_now + i) % CONFIG_NANOCOAP_CACHE_WHEEL_SLOTS];
+
+        while (pos != NIL) {
+            _pos_t next = _links[pos].wheel_next;
 
-    nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
-    return nanocoap_cache_del(lru_ce);
+            _expire(pos, now);
+            pos = next;
+        }
+    }
+    _wheel_now = now;
 }
 
-static int _cache_update_lru(clist_node_t *node)
+static int _cache_replacement_lru(void)
 {
-    if (clist_remove(&_cache_list_head, node)) {
-        /* Move an accessed node to the end of the list. Least
-         * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
-        return 0;
+    /* no element in the list */
+    if (_lru_head == NIL) {
+        return -1;
     }
-    return -1;
+
+    _stats.evictions++;
+    return nanocoap_cache_del(&_cache_entries[_lru_head]);
 }
 
 void nanocoap_cache_init(void)
 {
-    _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_in_use, 0, sizeof(_in_use));
+    memset(_buckets, 0xff, sizeof(_buckets));
+    memset(_wheel, 0xff, sizeof(_wheel));
+    memset(&_stats, 0, sizeof(_stats));
+    _used = 0;
+    _lru_head = NIL;
+    _lru_tail = NIL;
+    _wheel_now = ztimer_now(ZTIMER_SEC);
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+    random_bytes(_siphash_key, sizeof(_siphash_key));
+#endif
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -75,15 +297,35 @@ void nanocoap_cache_init(void)
 
 size_t nanocoap_cache_used_count(void)
 {
-    return clist_count(&_cache_list_head);
+    return _used;
 }
 
 size_t nanocoap_cache_free_count(void)
 {
-    return clist_count(&_empty_list_head);
+    return CONFIG_NANOCOAP_CACHE_ENTRIES - _used;
+}
+
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
+typedef void (*_digest_update_t)(void *ctx, const void *data, size_t len);
+
+static void _sha256_update(void *ctx, const void *data, size_t len)
+{
+    sha256_update(ctx, data, len);
 }
 
-static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+static void _siphash_update(void *ctx, const void *data, size_t len)
+{
+    siphash_update(ctx, data, len);
+}
+#endif
+
+static void _cache_key_digest_opts(const coap_pkt_t *req,
+        _digest_update_t update, void *ctx,
         bool include_etag,
         bool include_blockwise)
 {
@@ -111,8 +353,8 @@ static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
                     )) {
                 continue;
             }
-            sha256_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
-            sha256_update(ctx, value, optlen);
+            update(ctx, &opt.opt_num, sizeof(opt.opt_num));
+            update(ctx, value, optlen);
         }
     }
 }
@@ -121,7 +363,7 @@ void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
 {
     sha256_context_t ctx;
     sha256_init(&ctx);
-    _cache_key_digest_opts(req, &ctx, true, true);
+    _cache_key_digest_opts(req, _sha256_update, &ctx, true, true);
     sha256_final(&ctx, cache_key);
 }
 
@@ -129,24 +371,36 @@ void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *c
 {
     sha256_context_t ctx;
     sha256_init(&ctx);
-    _cache_key_digest_opts(req, &ctx, true, false);
+    _cache_key_digest_opts(req, _sha256_update, &ctx, true, false);
     sha256_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
+    bool include_etag = !IS_USED(MODULE_GCOAP_FORWARD_PROXY);
+    /* the payload of a FETCH request is part of the key */
+    bool include_payload = (req->hdr->code == COAP_METHOD_FETCH);
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+    siphash_context_t ctx;
+    siphash_init(&ctx, _siphash_key);
+
+    _cache_key_digest_opts(req, _siphash_update, &ctx, include_etag, true);
+    if (include_payload) {
+        siphash_update(&ctx, req->payload, req->payload_len);
+    }
+    le_uint64_t digest = byteorder_htolll(siphash_final(&ctx));
+    memcpy(cache_key, digest.u8, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
+#else
     sha256_context_t ctx;
     sha256_init(&ctx);
 
-    _cache_key_digest_opts(req, &ctx, !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
-    switch (req->hdr->code) {
-        case COAP_METHOD_FETCH:
-            sha256_update(&ctx, req->payload, req->payload_len);
-            break;
-        default:
-            break;
+    _cache_key_digest_opts(req, _sha256_update, &ctx, include_etag, true);
+    if (include_payload) {
+        sha256_update(&ctx, req->payload, req->payload_len);
     }
     sha256_final(&ctx, cache_key);
+#endif
 }
 
 ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
@@ -154,31 +408,37 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *cache_key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
+    _wheel_advance();
 
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
-    }
-    return 0;
-}
+    nanocoap_cache_entry_t *ce = _hash_find(cache_key);
 
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
+    if (ce) {
+        _pos_t pos = _pos(ce);
+
+        _lru_remove(pos);
+        _lru_append(pos);
+        if ((_links[pos].wheel_slot == NIL) &&
+            !nanocoap_cache_entry_is_stale(ce, _wheel_now)) {
+            /* was validated again */
+            _wheel_add(pos);
+        }
+    }
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce = _lookup(key);
 
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    else {
+        _stats.misses++;
+    }
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -199,7 +459,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -213,6 +473,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
             ce->max_age = ztimer_now(ZTIMER_SEC);
+            _wheel_update(_pos(ce));
         }
     }
     /* When a cache that recognizes and processes the ETag response
@@ -232,6 +493,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             uint32_t max_age = 60;
             coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
             ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+            _wheel_update(_pos(ce));
         }
         /* TODO: handle the copying of the new options (if changed) */
     }
@@ -243,6 +505,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
             ce->max_age = ztimer_now(ZTIMER_SEC);
+            _wheel_update(_pos(ce));
         }
     }
     /* This response is cacheable: Caches can use the Max-Age Option
@@ -277,7 +540,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
     bool add_to_cache = false;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
@@ -295,7 +558,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     /* no space left */
     if (!ce) {
         /* could not remove any entry */
-        if (_replacement_strategy()) {
+        if (_cache_replacement_lru()) {
             return NULL;
         }
         /* could remove an entry */
@@ -320,9 +583,16 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
+    _pos_t pos = _pos(ce);
+
     if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
+        bf_set(_in_use, pos);
+        _used++;
+        _hash_add(pos);
+        _lru_append(pos);
+        _links[pos].wheel_slot = NIL;
     }
+    _wheel_update(pos);
 
     return ce;
 }
@@ -344,14 +614,20 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
-
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
-        return 0;
+    if ((ce < _cache_entries) ||
+        (ce >= &_cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES]) ||
+        !bf_isset(_in_use, _pos(ce))) {
+        return -1;
     }
 
-    return -1;
+    _pos_t pos = _pos(ce);
+
+    _hash_remove(pos);
+    _lru_remove(pos);
+    _wheel_remove(pos);
+    bf_unset(_in_use, pos);
+    _used--;
+    memset(&_cache_entries[pos], 0, sizeof(nanocoap_cache_entry_t));
+    clist_rpush(&_empty_list_head, &_cache_entries[pos].node);
+    return 0;
 }
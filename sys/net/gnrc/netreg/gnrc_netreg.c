@@ -13,6 +13,7 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 #include <limits.h>
 
@@ -31,9 +32,44 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#ifdef MODULE_GNRC_NETREG_HASH
+/* The registry as lookup table by hash over gnrc_nettype_t and demux context */
+static gnrc_netreg_entry_t *netreg[CONFIG_GNRC_NETREG_HASH_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    /* multiplicative hashing, so that consecutive ports or protocol numbers
+     * are spread over all buckets */
+    uint32_t hash = (demux_ctx ^ ((uint32_t)type << 24)) * 2654435761U;
+
+    return &netreg[(hash >> 16) % CONFIG_GNRC_NETREG_HASH_BUCKETS];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    return (entry->demux_ctx == demux_ctx) && (entry->nettype == type);
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    (void)type;
+    return (entry->demux_ctx == demux_ctx);
+}
+#endif
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -63,7 +99,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -153,13 +189,18 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **head = _bucket(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+#ifdef MODULE_GNRC_NETREG_HASH
+    entry->nettype = type;
+#endif
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +213,14 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+
+    gnrc_netreg_entry_t **head = _bucket(type, entry->demux_ctx);
+
+    /* entry might not be registered, e.g. by a sock that was never bound, so
+     * its bucket might be empty */
+    if (*head != NULL) {
+        LL_DELETE(*head, entry);
+    }
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,8 +262,21 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
-        LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
+
+#ifdef MODULE_GNRC_NETREG_HASH
+        if (from) {
+            type = from->nettype;
+        }
+#endif
+        /* entries are prepended, so duplicates are found in reverse order of
+         * registration in either case */
+        for (res = head; res != NULL; res = res->next) {
+            if (_matches(res, type, demux_ctx)) {
+                break;
+            }
+        }
     }
 
     return res;
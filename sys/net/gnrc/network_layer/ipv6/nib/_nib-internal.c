@@ -29,6 +29,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-offl_trie.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -67,6 +68,7 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_offl_trie_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -520,6 +522,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
     }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
+        if (dst->pfx_len > 0) {
+            /* entry was allocated before but never got a mode */
+            _nib_offl_trie_remove(dst);
+        }
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
@@ -528,6 +534,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_offl_trie_add(dst);
     }
     return dst;
 }
@@ -549,6 +556,22 @@ static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 }
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+static void _nib_offl_trie_rebuild(void)
+{
+    /* try to index all entries again now that nodes were freed */
+    DEBUG("nib: rebuilding off-link entry trie\n");
+    _nib_offl_trie_init();
+    for (_nib_offl_entry_t *dst = _dsts; _in_dsts(dst); dst++) {
+        if (dst->pfx_len > 0) {
+            _nib_offl_trie_add(dst);
+        }
+    }
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_offl_trie_rebuild()    (void)0
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
 void _nib_offl_clear(_nib_offl_entry_t *dst)
 {
     if (dst->mode == _EMPTY) {
@@ -566,7 +589,13 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (dst->pfx_len > 0) {
+            _nib_offl_trie_remove(dst);
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        if (!_nib_offl_trie_is_complete()) {
+            _nib_offl_trie_rebuild();
+        }
     }
     else {
         DEBUG("nib: offlink entry %s/%u with mode %u not cleared\n",
@@ -597,10 +626,15 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
+    uint8_t best_len = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    if (_nib_offl_trie_is_complete()) {
+        res = _nib_offl_trie_get_match(dst);
+        DEBUG("nib: best match from trie is %p\n", (void *)res);
+        return res;
+    }
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -613,10 +647,10 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            if ((match >= entry->pfx_len) && (entry->pfx_len > best_len)) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
@@ -199,7 +199,7 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -221,6 +221,13 @@ typedef struct {
                                      valid (UINT32_MAX means forever) */
     uint32_t pref_until;        /**< timestamp (in ms) until which the prefix
                                      preferred (UINT32_MAX means forever) */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Next off-link entry with the same prefix in the longest prefix
+     *          match trie
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
 } _nib_offl_entry_t;
 
 /**
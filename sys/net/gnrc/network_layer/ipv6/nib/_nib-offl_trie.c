@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * The trie is a path-compressed binary trie: every node stores a prefix and
+ * only exists if it either holds off-link entries with exactly that prefix or
+ * if it branches into two sub-tries. A node's children extend its prefix with
+ * a 0 or 1 bit respectively at position _nib_offl_trie_node_t::pfx_len.
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+#include "_nib-offl_trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+typedef struct _nib_offl_trie_node {
+    struct _nib_offl_trie_node *parent;     /**< parent node */
+    struct _nib_offl_trie_node *child[2];   /**< 0 and 1 branch */
+    _nib_offl_entry_t *entries;             /**< entries with this prefix */
+    ipv6_addr_t pfx;                        /**< prefix of the node */
+    uint8_t pfx_len;                        /**< length of the prefix */
+} _nib_offl_trie_node_t;
+
+static _nib_offl_trie_node_t _nodes[CONFIG_GNRC_IPV6_NIB_OFFL_TRIE_NUMOF];
+static _nib_offl_trie_node_t *_free;
+static _nib_offl_trie_node_t *_root;
+static bool _incomplete;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static inline unsigned _min(unsigned a, unsigned b)
+{
+    return (a < b) ? a : b;
+}
+
+static void _reset(void)
+{
+    _free = NULL;
+    _root = NULL;
+    for (unsigned i = 0; i < ARRAY_SIZE(_nodes); i++) {
+        _nodes[i].parent = _free;
+        _free = &_nodes[i];
+    }
+}
+
+static _nib_offl_trie_node_t *_node_alloc(const ipv6_addr_t *pfx,
+                                          unsigned pfx_len)
+{
+    _nib_offl_trie_node_t *node = _free;
+
+    if (node != NULL) {
+        _free = node->parent;
+        memset(node, 0, sizeof(*node));
+        ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+        node->pfx_len = pfx_len;
+    }
+    return node;
+}
+
+static void _node_free(_nib_offl_trie_node_t *node)
+{
+    node->parent = _free;
+    _free = node;
+}
+
+static _nib_offl_trie_node_t **_link_to(_nib_offl_trie_node_t *node)
+{
+    _nib_offl_trie_node_t *parent = node->parent;
+
+    if (parent == NULL) {
+        return &_root;
+    }
+    return &parent->child[parent->child[1] == node];
+}
+
+/* keep entries sorted by their position in the NIB */
+static void _entry_link(_nib_offl_trie_node_t *node, _nib_offl_entry_t *dst)
+{
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    while ((*ptr != NULL) && (*ptr < dst)) {
+        ptr = &(*ptr)->trie_next;
+    }
+    dst->trie_next = *ptr;
+    *ptr = dst;
+}
+
+static bool _add(_nib_offl_entry_t *dst)
+{
+    _nib_offl_trie_node_t **link = &_root;
+    _nib_offl_trie_node_t *parent = NULL;
+    _nib_offl_trie_node_t *node;
+    const unsigned pfx_len = dst->pfx_len;
+
+    while ((node = *link) != NULL) {
+        unsigned common = _min(ipv6_addr_match_prefix(&node->pfx, &dst->pfx),
+                               _min(node->pfx_len, pfx_len));
+
+        if (common == node->pfx_len) {
+            if (common == pfx_len) {
+                _entry_link(node, dst);
+                return true;
+            }
+            parent = node;
+            link = &node->child[_bit(&dst->pfx, common)];
+            continue;
+        }
+
+        /* prefixes diverge within node's prefix: node becomes a child of a
+         * new node */
+        _nib_offl_trie_node_t *split = _node_alloc(&dst->pfx, common);
+
+        if (split == NULL) {
+            return false;
+        }
+        if (common < pfx_len) {
+            /* dst needs its own leaf next to node */
+            _nib_offl_trie_node_t *leaf = _node_alloc(&dst->pfx, pfx_len);
+
+            if (leaf == NULL) {
+                _node_free(split);
+                return false;
+            }
+            _entry_link(leaf, dst);
+            leaf->parent = split;
+            split->child[_bit(&dst->pfx, common)] = leaf;
+        }
+        else {
+            _entry_link(split, dst);
+        }
+        split->parent = parent;
+        split->child[_bit(&node->pfx, common)] = node;
+        node->parent = split;
+        *link = split;
+        return true;
+    }
+
+    node = _node_alloc(&dst->pfx, pfx_len);
+    if (node == NULL) {
+        return false;
+    }
+    _entry_link(node, dst);
+    node->parent = parent;
+    *link = node;
+    return true;
+}
+
+static _nib_offl_trie_node_t *_find(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _nib_offl_trie_node_t *node = _root;
+
+    while ((node != NULL) && (node->pfx_len <= pfx_len) &&
+           (ipv6_addr_match_prefix(&node->pfx, pfx) >= node->pfx_len)) {
+        if (node->pfx_len == pfx_len) {
+            return node;
+        }
+        node = node->child[_bit(pfx, node->pfx_len)];
+    }
+    return NULL;
+}
+
+void _nib_offl_trie_init(void)
+{
+    _reset();
+    _incomplete = false;
+}
+
+void _nib_offl_trie_add(_nib_offl_entry_t *dst)
+{
+    assert((dst != NULL) && (dst->pfx_len > 0));
+    if (!_add(dst)) {
+        DEBUG("nib: trie out of nodes, falling back to linear search\n");
+        _incomplete = true;
+    }
+}
+
+void _nib_offl_trie_remove(_nib_offl_entry_t *dst)
+{
+    _nib_offl_trie_node_t *node = _find(&dst->pfx, dst->pfx_len);
+
+    if (node != NULL) {
+        _nib_offl_entry_t **ptr = &node->entries;
+
+        while ((*ptr != NULL) && (*ptr != dst)) {
+            ptr = &(*ptr)->trie_next;
+        }
+        if (*ptr != NULL) {
+            *ptr = dst->trie_next;
+        }
+        dst->trie_next = NULL;
+
+        /* remove nodes that neither hold entries nor branch anymore */
+        while ((node != NULL) && (node->entries == NULL) &&
+               ((node->child[0] == NULL) || (node->child[1] == NULL))) {
+            _nib_offl_trie_node_t *child = (node->child[0] != NULL)
+                                         ? node->child[0] : node->child[1];
+            _nib_offl_trie_node_t *parent = node->parent;
+
+            *_link_to(node) = child;
+            _node_free(node);
+            if (child != NULL) {
+                child->parent = parent;
+                break;
+            }
+            /* parent lost a child, check if it is still needed */
+            node = parent;
+        }
+    }
+}
+
+bool _nib_offl_trie_is_complete(void)
+{
+    return !_incomplete;
+}
+
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_trie_node_t *node = _root;
+    _nib_offl_entry_t *res = NULL;
+
+    assert(!_incomplete);
+    while ((node != NULL) &&
+           (ipv6_addr_match_prefix(&node->pfx, dst) >= node->pfx_len)) {
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->trie_next) {
+            if (entry->mode != _EMPTY) {
+                res = entry;
+                break;
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->pfx_len)];
+    }
+    return res;
+}
+
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Longest prefix match index over the off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ */
+
+#include <kernel_defines.h>
+#include <stdbool.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Initializes (and empties) the trie
+ */
+void _nib_offl_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * @pre `(dst != NULL) && (dst->pfx_len > 0)`
+ *
+ * @param[in] dst   An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_offl_trie_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @pre `dst != NULL`
+ *
+ * @param[in] dst   An off-link entry. Its prefix must be unchanged since it
+ *                  was added with @ref _nib_offl_trie_add().
+ */
+void _nib_offl_trie_remove(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Checks if all off-link entries are indexed by the trie
+ *
+ * @return  true, if @ref _nib_offl_trie_get_match() can be used.
+ * @return  false, if the trie ran out of nodes and off-link entries need to
+ *          be searched linearly.
+ */
+bool _nib_offl_trie_is_complete(void);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Of multiple entries with the same prefix, the one allocated first in the
+ * NIB's off-link entry array is returned. Entries without a
+ * [mode](@ref net_gnrc_ipv6_nib_mode) are skipped.
+ *
+ * @pre `_nib_offl_trie_is_complete()`
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching off-link entry for @p dst.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE || defined(DOXYGEN) */
+#define _nib_offl_trie_init()               (void)0
+#define _nib_offl_trie_add(dst)             (void)dst
+#define _nib_offl_trie_remove(dst)          (void)dst
+#define _nib_offl_trie_is_complete()        (false)
+#define _nib_offl_trie_get_match(dst)       (NULL)
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
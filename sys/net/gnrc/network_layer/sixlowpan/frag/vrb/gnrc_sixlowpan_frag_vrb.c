@@ -13,6 +13,9 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "net/ieee802154.h"
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/ipv6/addr.h"
@@ -30,7 +33,24 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE >=
+              CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE,
+              "VRB index must have at least as many slots as the VRB");
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < UINT8_MAX
+typedef uint8_t _vrb_idx_t;
+#else
+typedef uint16_t _vrb_idx_t;
+#endif
+
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+/* Open-addressing hash index (linear probing) over (src, tag) of _vrb.
+ * A slot holds 1 + the position of the entry in _vrb, or 0 if it is unused.
+ * Entries are removed with gnrc_sixlowpan_frag_vrb_rm() outside of this
+ * file, so slots may go stale: lookups verify the entry and slots of empty
+ * entries get reused on insertion. gnrc_sixlowpan_frag_vrb_gc() rebuilds the
+ * index to purge stale slots. */
+static _vrb_idx_t _index[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE];
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,70 +66,142 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static unsigned _hash(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    /* FNV-1a over source address and tag */
+    uint32_t hash = 2166136261U;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE;
+}
+
+static inline unsigned _next_slot(unsigned slot)
+{
+    return (slot + 1) % CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_index_get(const uint8_t *src,
+                                             size_t src_len, unsigned tag)
+{
+    unsigned slot = _hash(src, src_len, tag);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE; i++) {
+        if (_index[slot] == 0) {
+            break;
+        }
+
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[_index[slot] - 1];
+
+        /* empty entries never match as src_len != 0 */
+        if (_equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+        slot = _next_slot(slot);
+    }
+    return NULL;
+}
+
+static bool _index_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    const _vrb_idx_t idx = (vrbe - _vrb) + 1;
+    unsigned slot = _hash(vrbe->super.src, vrbe->super.src_len,
+                          vrbe->super.tag);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX_SIZE; i++) {
+        if ((_index[slot] == 0) || (_index[slot] == idx) ||
+            gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[_index[slot] - 1])) {
+            _index[slot] = idx;
+            return true;
+        }
+        slot = _next_slot(slot);
+    }
+    return false;
+}
+
+static void _index_rebuild(void)
+{
+    memset(_index, 0, sizeof(_index));
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            /* can't fail: there are at least as many slots as entries */
+            _index_add(&_vrb[i]);
+        }
+    }
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
-
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
-                        }
-                    }
-                    else {
-                        vrbe->super.ints = base->ints;
+    vrbe = _index_get(base->src, base->src_len, base->tag);
+    for (unsigned i = 0; (vrbe == NULL) &&
+                         (i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE); i++) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            vrbe = &_vrb[i];
+        }
+    }
+    if (vrbe == NULL) {
+        DEBUG("6lo vrb: VRB is full\n");
+    }
+    else if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
+        vrbe->super = *base;
+        vrbe->out_netif = out_netif;
+        memcpy(vrbe->super.dst, out_dst, out_dst_len);
+        vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+        vrbe->super.dst_len = out_dst_len;
+        DEBUG("6lo vrb: creating entry (%s, ",
+              gnrc_netif_addr_to_str(vrbe->super.src,
+                                     vrbe->super.src_len,
+                                     addr_str));
+        DEBUG("%s, %u, %u) => ",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str),
+              (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+        DEBUG("(%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        if (!_index_add(vrbe)) {
+            /* index is clogged with stale slots */
+            _index_rebuild();
+        }
+    }
+    /* _equal_index() => append intervals of `base`, so they don't get
+     * lost. We use append, so we don't need to change base! */
+    else if (base->ints != NULL) {
+        gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+
+        if (tmp != base->ints) {
+            /* base->ints is not already vrbe->super.ints */
+            if (tmp != NULL) {
+                /* iterate before appending and check if `base->ints` is
+                 * not already part of list */
+                while (tmp->next != NULL) {
+                    if (tmp == base->ints) {
+                        tmp = NULL;
+                        break;
                     }
+                    tmp = tmp->next;
+                }
+                if (tmp != NULL) {
+                    tmp->next = base->ints;
                 }
             }
-            break;
+            else {
+                vrbe->super.ints = base->ints;
+            }
         }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
@@ -170,16 +262,15 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _index_get(src, src_len, src_tag);
+
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -228,12 +319,14 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
             gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
         }
     }
+    _index_rebuild();
 }
 
 #ifdef TEST_SUITES
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    memset(_index, 0, sizeof(_index));
 }
 #endif
 
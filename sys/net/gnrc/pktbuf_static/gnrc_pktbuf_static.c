@@ -43,6 +43,47 @@ static_assert((CONFIG_GNRC_PKTBUF_SIZE % sizeof(_unused_t)) == 0,
               "CONFIG_GNRC_PKTBUF_SIZE has to be a multiple of 8");
 static _unused_t *_first_unused;
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+#define _SLAB_ALIGN(size)   (((size) + GNRC_PKTBUF_STATIC_ALIGN_MASK) & \
+                             ~(GNRC_PKTBUF_STATIC_ALIGN_MASK))
+
+/**
+ * @brief   A size class of the slab front-end
+ */
+typedef struct {
+    _unused_t *free;        /**< list of free objects */
+    uint16_t size;          /**< size of each object */
+    uint16_t used;          /**< number of objects handed out */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< high-water mark of _slab_t::used */
+    uint16_t fallbacks;     /**< allocations that went to the arena as the
+                             *   class was exhausted */
+#endif
+} _slab_t;
+
+static const uint16_t _slab_sizes[] = {
+    _SLAB_ALIGN(sizeof(gnrc_pktsnip_t)),
+    CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE,
+};
+
+#define _SLAB_NUMOF         ARRAY_SIZE(_slab_sizes)
+#define _SLAB_BYTES         (CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF * \
+                             (_SLAB_ALIGN(sizeof(gnrc_pktsnip_t)) + \
+                              CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE))
+
+static_assert((CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE % sizeof(_unused_t)) == 0,
+              "CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE has to be a multiple of 8");
+static_assert(_SLAB_BYTES + sizeof(_unused_t) <= CONFIG_GNRC_PKTBUF_SIZE,
+              "slabs do not fit into CONFIG_GNRC_PKTBUF_SIZE");
+
+static _slab_t _slabs[_SLAB_NUMOF];
+
+/* slabs are placed at the start of _static_buf, the arena follows */
+#define _ARENA_START        _SLAB_BYTES
+#else
+#define _ARENA_START        (0U)
+#endif
+
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
@@ -53,6 +94,121 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+static void _slab_init(void)
+{
+    uint8_t *obj = _static_buf;
+
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        memset(slab, 0, sizeof(*slab));
+        slab->size = _slab_sizes[i];
+        /* thread free list in reverse, so objects are handed out in order */
+        obj += CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF * slab->size;
+        for (unsigned j = 0; j < CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF; j++) {
+            obj -= slab->size;
+            /* cast to uintptr_t as intermediate step to silence -Wcast-align,
+             * objects are multiples of sizeof(_unused_t) */
+            _unused_t *ptr = (_unused_t *)(uintptr_t)obj;
+            ptr->next = slab->free;
+            ptr->size = slab->size;
+            slab->free = ptr;
+        }
+        obj += CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF * slab->size;
+    }
+}
+
+/* returns the slab that ptr belongs to, or NULL if it is in the arena */
+static _slab_t *_slab_of(const void *ptr)
+{
+    const uint8_t *start = _static_buf;
+
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        const uint8_t *end = start + (CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF *
+                                      _slabs[i].size);
+
+        if (((const uint8_t *)ptr >= start) && ((const uint8_t *)ptr < end)) {
+            assert((((const uint8_t *)ptr - start) % _slabs[i].size) == 0);
+            return &_slabs[i];
+        }
+        start = end;
+    }
+    return NULL;
+}
+
+static void *_slab_alloc(size_t size)
+{
+    _slab_t *best = NULL;
+
+    /* best fit, the number of classes is tiny */
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        if ((size <= _slabs[i].size) &&
+            ((best == NULL) || (_slabs[i].size < best->size))) {
+            best = &_slabs[i];
+        }
+    }
+    if (best == NULL) {
+        return NULL;
+    }
+    if (best->free == NULL) {
+#ifdef DEVELHELP
+        best->fallbacks++;
+#endif
+        return NULL;
+    }
+
+    _unused_t *ptr = best->free;
+
+    best->free = ptr->next;
+    best->used++;
+#ifdef DEVELHELP
+    if (best->used > best->max_used) {
+        best->max_used = best->used;
+    }
+#endif
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(ptr, ~GNRC_PKTBUF_CANARY, best->size);
+    }
+    return ptr;
+}
+
+static void _slab_free(_slab_t *slab, void *data)
+{
+    _unused_t *ptr = data;
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        size_t chk_len = slab->size - sizeof(*ptr);
+        if (chk_len &&
+            !memchk((uint8_t *)data + sizeof(*ptr), GNRC_PKTBUF_CANARY, chk_len)) {
+            printf("pktbuf: double free detected! (at %p, len=%u)\n",
+                   data, (unsigned)slab->size);
+            DEBUG_BREAKPOINT(2);
+        }
+        memset(data, GNRC_PKTBUF_CANARY, slab->size);
+    }
+    assert(slab->used > 0);
+    ptr->next = slab->free;
+    ptr->size = slab->size;
+    slab->free = ptr;
+    slab->used--;
+}
+
+static inline size_t _slab_obj_size(const void *ptr)
+{
+    _slab_t *slab = _slab_of(ptr);
+
+    return (slab) ? slab->size : 0;
+}
+#else
+static inline size_t _slab_obj_size(const void *ptr)
+{
+    (void)ptr;
+    return 0;
+}
+#endif
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -72,11 +228,14 @@ void gnrc_pktbuf_init(void)
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
     }
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+    _slab_init();
+#endif
     /* Silence false -Wcast-align: _static_buf has qualifier
      * `alignas(_unused_t)`, so it is guaranteed to be safe */
-    _first_unused = (_unused_t *)(uintptr_t)_static_buf;
+    _first_unused = (_unused_t *)(uintptr_t)&_static_buf[_ARENA_START];
     _first_unused->next = NULL;
-    _first_unused->size = sizeof(_static_buf);
+    _first_unused->size = sizeof(_static_buf) - _ARENA_START;
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -119,9 +278,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&gnrc_pktbuf_mutex);
         return NULL;
     }
-    /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+    /* marked data would not fit _unused_t marker or is a slab object that
+     * can't be split => move data around to allow for proper free */
+    if ((pkt->size != size) &&
+        ((size < required_new_size) || _slab_obj_size(pkt->data))) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -177,6 +337,11 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = NULL;
     }
+    /* slab objects are never split, so data still fits if it is not larger
+     * than the object */
+    else if ((pkt->data != NULL) && (size <= _slab_obj_size(pkt->data))) {
+        /* nothing to do */
+    }
     /* if new size is bigger than old size */
     else if (size > pkt->size) {    /* new size does not fit */
         void *new_data = _pktbuf_alloc(size);
@@ -267,10 +432,35 @@ static inline void _print_unused(_unused_t *ptr)
     printf(", size: %4u) ~\n", ptr->size);
 }
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+static void _print_slab_stats(void)
+{
+    unsigned holes = 0, free_bytes = 0, largest = 0;
+
+    puts("  slab size numof used max used fallbacks");
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        printf("  %4u %4u %5u %4u %8u %9u\n", i, _slabs[i].size,
+               CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF, _slabs[i].used,
+               _slabs[i].max_used, _slabs[i].fallbacks);
+    }
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        holes++;
+        free_bytes += ptr->size;
+        if (ptr->size > largest) {
+            largest = ptr->size;
+        }
+    }
+    /* share of free arena memory not usable for the largest allocation */
+    printf("  arena: %u bytes free in %u holes, largest %u, "
+           "fragmentation %u%%\n", free_bytes, holes, largest,
+           (free_bytes) ? (100U - ((100U * largest) / free_bytes)) : 0);
+}
+#endif
+
 void gnrc_pktbuf_stats(void)
 {
     _unused_t *ptr = _first_unused;
-    uint8_t *chunk = &_static_buf[0];
+    uint8_t *chunk = &_static_buf[_ARENA_START];
     int count = 0;
 
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
@@ -278,8 +468,11 @@ void gnrc_pktbuf_stats(void)
            (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
            CONFIG_GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+    _print_slab_stats();
+#endif
     if (ptr == NULL) {  /* packet buffer is completely full */
-        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
+        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE - _ARENA_START, count++);
     }
 
     if (((void *)ptr) == ((void *)chunk)) { /* _first_unused is at the beginning */
@@ -310,8 +503,15 @@ void gnrc_pktbuf_stats(void)
 #ifdef TEST_SUITES
 bool gnrc_pktbuf_is_empty(void)
 {
-    return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
-           (_first_unused->size == sizeof(_static_buf));
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+#endif
+    return ((uintptr_t)_first_unused == (uintptr_t)&_static_buf[_ARENA_START]) &&
+           (_first_unused->size == sizeof(_static_buf) - _ARENA_START);
 }
 
 bool gnrc_pktbuf_is_sane(void)
@@ -330,7 +530,7 @@ bool gnrc_pktbuf_is_sane(void)
      */
 
     while (ptr) {
-        if ((&_static_buf[0] >= (uint8_t *)ptr)
+        if ((&_static_buf[_ARENA_START] > (uint8_t *)ptr)
             && ((uint8_t *)ptr >= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE])) {
             return false;
         }
@@ -378,6 +578,12 @@ static void *_pktbuf_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+    void *obj = _slab_alloc(size);
+    if (obj != NULL) {
+        return obj;
+    }
+#endif
     size = _align(size);
     while (ptr && (size > ptr->size)) {
         prev = ptr;
@@ -472,6 +678,14 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         return;
     }
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+    _slab_t *slab = _slab_of(data);
+    if (slab != NULL) {
+        _slab_free(slab, data);
+        return;
+    }
+#endif
+
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         /* check if the data has already been marked as free */
         size_t chk_len = _align(size) - sizeof(*new);
@@ -18,6 +18,7 @@
 #include <stdlib.h>
 
 #include "compiler_hints.h"
+#include "irq.h"
 #include "log.h"
 #include "macros/math.h"
 #include "net/af.h"
@@ -76,6 +77,25 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_register(type, &reg->entry);
 }
 
+int gnrc_sock_set_queue(gnrc_sock_reg_t *reg, msg_t *queue, unsigned queue_size)
+{
+    assert((reg != NULL) && (queue != NULL));
+    if ((queue_size == 0) || (queue_size & (queue_size - 1))) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+
+    if (mbox_avail(&reg->mbox) > 0) {
+        irq_restore(state);
+        return -EBUSY;
+    }
+    mbox_init(&reg->mbox, queue, queue_size);
+    irq_restore(state);
+
+    return 0;
+}
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote,
                        gnrc_sock_recv_aux_t *aux)
@@ -98,7 +118,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 
-    if (mbox_size(&reg->mbox) != GNRC_SOCK_MBOX_SIZE) {
+    if (mbox_size(&reg->mbox) == 0) {
         return -EINVAL;
     }
 
@@ -140,6 +140,51 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+/**
+ * @brief   Replaces the receive queue of a sock
+ *
+ * By default every sock queues up to @ref GNRC_SOCK_MBOX_SIZE packets,
+ * further packets are dropped. A sock receiving bursts can be given a larger
+ * queue right after it was created.
+ *
+ * @pre `(reg != NULL) && (queue != NULL)`
+ *
+ * @param[in] reg           Registration of a sock.
+ * @param[in] queue         Queue to use from now on. Must stay valid until
+ *                          the sock is closed.
+ * @param[in] queue_size    Number of elements in @p queue, must be a power
+ *                          of two.
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p queue_size is not a power of two
+ * @return  -EBUSY, if packets are already queued for the sock
+ */
+int gnrc_sock_set_queue(gnrc_sock_reg_t *reg, msg_t *queue,
+                        unsigned queue_size);
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Replaces the receive queue of a UDP sock
+ *
+ * @see gnrc_sock_set_queue()
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in] queue         Queue to use from now on. Must stay valid until
+ *                          the sock is closed.
+ * @param[in] queue_size    Number of elements in @p queue, must be a power
+ *                          of two.
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p queue_size is not a power of two
+ * @return  -EBUSY, if packets are already queued for the sock
+ */
+static inline int gnrc_sock_udp_set_queue(sock_udp_t *sock, msg_t *queue,
+                                          unsigned queue_size)
+{
+    return gnrc_sock_set_queue(&sock->reg, queue, queue_size);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
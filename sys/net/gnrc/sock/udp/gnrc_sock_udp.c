@@ -212,6 +212,48 @@ ssize_t sock_udp_recv_aux(sock_udp_t *sock, void *data, size_t max_len,
     return (nobufs) ? -ENOBUFS : ((res < 0) ? res : ret);
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned numof,
+                       uint32_t timeout)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    for (i = 0; i < numof; i++) {
+        sock_udp_msg_t *msg = &msgs[i];
+        void *pkt = NULL, *ctx = NULL;
+        uint8_t *ptr = msg->data;
+        ssize_t res;
+
+        /* only wait for the first message, take the others if queued */
+        res = sock_udp_recv_buf_aux(sock, &pkt, &ctx, (i == 0) ? timeout : 0,
+                                    &msg->remote, NULL);
+        if (res < 0) {
+            if (i == 0) {
+                return res;
+            }
+            if (res == -EAGAIN) {
+                break;
+            }
+            msg->len = res;
+            continue;
+        }
+
+        msg->len = 0;
+        do {
+            if ((msg->len < 0) || ((size_t)(msg->len + res) > msg->max_len)) {
+                msg->len = -ENOBUFS;
+                continue;
+            }
+            memcpy(ptr, pkt, res);
+            ptr += res;
+            msg->len += res;
+        } while ((res = sock_udp_recv_buf_aux(sock, &pkt, &ctx, 0, NULL,
+                                              NULL)) > 0);
+    }
+
+    return i;
+}
+
 static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
                            const sock_ip_ep_t *remote)
 {
@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       QUIC congestion control for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "congure/quic.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "net/gnrc/tcp/congure_snd.h"
+
+static congure_quic_snd_t _tcp_congures_quic[CONFIG_GNRC_TCP_RCV_BUFFERS];
+static const congure_quic_snd_consts_t _tcp_congure_quic_consts = {
+    /* cong_event_cb to resend a segment is not needed since GNRC TCP
+     * retransmits segments lost or timed out itself */
+    .init_wnd = 3U * CONFIG_GNRC_TCP_MSS,
+    .min_wnd = 2U * CONFIG_GNRC_TCP_MSS,
+    .init_rtt = 333U,
+    .max_msg_size = CONFIG_GNRC_TCP_MSS,
+    .pc_thresh = 3000,
+    .granularity = 1,
+    .loss_reduction_numerator = 1,
+    .loss_reduction_denominator = 2,
+    .inter_msg_interval_numerator = 5,
+    .inter_msg_interval_denominator = 4,
+};
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures_quic); i++) {
+        if (_tcp_congures_quic[i].super.driver == NULL) {
+            congure_quic_snd_setup(&_tcp_congures_quic[i],
+                                   &_tcp_congure_quic_consts);
+            return &_tcp_congures_quic[i].super;
+        }
+    }
+    return NULL;
+}
+
+/** @} */
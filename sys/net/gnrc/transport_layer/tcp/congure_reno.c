@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       TCP Reno congestion control for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "congure/abe.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "net/gnrc/tcp/congure_snd.h"
+
+#if IS_USED(MODULE_CONGURE_ABE)
+typedef congure_abe_snd_t _tcp_congure_snd_t;
+#else
+typedef congure_reno_snd_t _tcp_congure_snd_t;
+#endif
+
+#define TCP_CONGURE_RENO_CONSTS { \
+        .fr = _fr, \
+        .same_wnd_adv = _same_wnd_adv, \
+        .ss_cwnd_inc = _ss_cwnd_inc, \
+        .ca_cwnd_inc = _ca_cwnd_inc, \
+        .init_mss = CONFIG_GNRC_TCP_MSS, \
+        .cwnd_upper = 2190U, \
+        .cwnd_lower = 1095U, \
+        .init_ssthresh = CONGURE_WND_SIZE_MAX, \
+        .frthresh = 3U, \
+    }
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _ss_cwnd_inc(congure_reno_snd_t *c);
+static void _ca_cwnd_inc(congure_reno_snd_t *c);
+
+static _tcp_congure_snd_t _tcp_congures[CONFIG_GNRC_TCP_RCV_BUFFERS];
+#if IS_USED(MODULE_CONGURE_ABE)
+static const congure_abe_snd_consts_t _tcp_congure_abe_consts = {
+    .reno = TCP_CONGURE_RENO_CONSTS,
+    .abe_multiplier_numerator = CONFIG_CONGURE_ABE_MULTIPLIER_NUMERATOR_DEFAULT,
+    .abe_multiplier_denominator = CONFIG_CONGURE_ABE_MULTIPLIER_DENOMINATOR_DEFAULT,
+};
+#else
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = TCP_CONGURE_RENO_CONSTS;
+#endif
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures); i++) {
+        if (_tcp_congures[i].super.driver == NULL) {
+#if IS_USED(MODULE_CONGURE_ABE)
+            congure_abe_snd_setup(&_tcp_congures[i],
+                                  &_tcp_congure_abe_consts);
+#else
+            congure_reno_snd_setup(&_tcp_congures[i],
+                                   &_tcp_congure_reno_consts);
+#endif
+            return &_tcp_congures[i].super;
+        }
+    }
+    return NULL;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* GNRC TCP retransmits the lost segment itself, so do nothing */
+    return;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    (void)c;
+    (void)ack;
+    /* GNRC TCP only reports ACKs for new data */
+    return true;
+}
+
+static void _cwnd_inc(congure_reno_snd_t *c, congure_wnd_size_t inc)
+{
+    /* the window size is only 16 bit wide, so saturate */
+    if (c->super.cwnd > (CONGURE_WND_SIZE_MAX - inc)) {
+        c->super.cwnd = CONGURE_WND_SIZE_MAX;
+    }
+    else {
+        c->super.cwnd += inc;
+    }
+}
+
+static void _ss_cwnd_inc(congure_reno_snd_t *c)
+{
+    _cwnd_inc(c, c->mss);
+}
+
+static void _ca_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* grow by about one MSS per round trip time (RFC 5681, section 3.1) */
+    uint32_t inc = ((uint32_t)c->mss * c->mss) / c->super.cwnd;
+
+    _cwnd_inc(c, (inc > 0) ? inc : 1);
+}
+
+/** @} */
@@ -32,6 +32,7 @@
 #include "net/gnrc/tcp.h"
 #include "net/sock.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_eventloop.h"
@@ -76,6 +77,32 @@ static void _unsched_mbox(evtimer_mbox_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+static ssize_t _closed(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->status & STATUS_ABORTED) {
+        TCP_DEBUG_ERROR("-ECONNABORTED: Retransmissions were not acknowledged.");
+        TCP_DEBUG_LEAVE;
+        return -ECONNABORTED;
+    }
+    TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
+    TCP_DEBUG_LEAVE;
+    return -ECONNRESET;
+}
+
+static ssize_t _not_connected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
+{
+    TCP_DEBUG_ENTER;
+    if ((state == FSM_STATE_CLOSED) && (tcb->status & STATUS_ABORTED)) {
+        TCP_DEBUG_ERROR("-ECONNABORTED: Retransmissions were not acknowledged.");
+        TCP_DEBUG_LEAVE;
+        return -ECONNABORTED;
+    }
+    TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
+    TCP_DEBUG_LEAVE;
+    return -ENOTCONN;
+}
+
 static void _close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -84,6 +111,7 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
     _gnrc_tcp_fsm_state_t state = 0;
+    int ret = 0;
 
     /* Return if connection is closed */
     state = _gnrc_tcp_fsm_get_state(tcb);
@@ -99,7 +127,7 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     _sched_connection_timeout(&tcb->event_misc, &mbox);
 
     /* Start connection teardown sequence */
-    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
 
     /* Loop until the connection has been closed */
     state = _gnrc_tcp_fsm_get_state(tcb);
@@ -113,6 +141,11 @@ static void _close(gnrc_tcp_tcb_t *tcb)
 
             case MSG_TYPE_NOTIFY_USER:
                 TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
+
+                /* Retry sending the FIN after the retransmission queue drained */
+                if (ret == -EAGAIN) {
+                    ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+                }
                 break;
 
             default:
@@ -327,6 +360,24 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *cong)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(cong != NULL);
+
+    mutex_lock(&(tcb->function_lock));
+    assert(_gnrc_tcp_fsm_get_state(tcb) == FSM_STATE_CLOSED);
+
+    /* Return a state object taken from the pool by a previous connection */
+    _gnrc_tcp_congure_release(tcb);
+    tcb->congure = cong;
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
 {
     TCP_DEBUG_ENTER;
@@ -702,9 +753,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     state = _gnrc_tcp_fsm_get_state(tcb);
     if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_CLOSE_WAIT) {
         mutex_unlock(&(tcb->function_lock));
-        TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
         TCP_DEBUG_LEAVE;
-        return -ENOTCONN;
+        return _not_connected(tcb, state);
     }
 
     /* Early return for zero length payloads to send */
@@ -725,14 +775,13 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was queued for transmission */
+    while (ret == 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
         if (state == FSM_STATE_CLOSED) {
-            TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
-            ret = -ECONNRESET;
+            ret = _closed(tcb);
             break;
         }
 
@@ -752,6 +801,9 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         /* Try to send data in case there nothing has been sent and we are not probing */
         if (ret == 0 && !probing_mode) {
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            if (ret != 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -766,7 +818,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                 ret = -ETIMEDOUT;
                 break;
@@ -837,9 +888,8 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_FIN_WAIT_1 &&
         state != FSM_STATE_FIN_WAIT_2 && state != FSM_STATE_CLOSE_WAIT) {
         mutex_unlock(&(tcb->function_lock));
-        TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
         TCP_DEBUG_LEAVE;
-        return -ENOTCONN;
+        return _not_connected(tcb, state);
     }
 
     /* Early return for zero length buffers to store received data */
@@ -886,8 +936,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         /* Check if the connections state is closed. If so, a reset was received */
         state = _gnrc_tcp_fsm_get_state(tcb);
         if (state == FSM_STATE_CLOSED) {
-            TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
-            ret = -ECONNRESET;
+            ret = _closed(tcb);
             break;
         }
 
@@ -912,7 +961,6 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
                     TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                    _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                     TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                     ret = -ETIMEDOUT;
                     break;
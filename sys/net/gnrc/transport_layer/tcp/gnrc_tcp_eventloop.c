@@ -330,14 +330,29 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_TIMEOUT_TIMEWAIT, NULL, NULL, 0);
                 break;
 
-           /* A connection opening attempt from a TCB in listening mode failed.
-            * Clear retransmission and re-open for next attempt */
+            /* Pacing timer expired: Call FSM to allow the next data segment */
+            case MSG_TYPE_PACING:
+                TCP_DEBUG_INFO("Received MSG_TYPE_PACING.");
+                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                              FSM_EVENT_TIMEOUT_PACING, NULL, NULL, 0);
+                break;
+
             case MSG_TYPE_CONNECTION_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_CONNECTION_TIMEOUT.");
-                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
-                              FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
-                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
-                              FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+                /* A connection opening attempt from a TCB in listening mode failed.
+                 * Clear retransmission and re-open for next attempt */
+                if (_gnrc_tcp_fsm_get_state((gnrc_tcp_tcb_t *)msg.content.ptr) ==
+                    FSM_STATE_SYN_RCVD) {
+                    _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                                  FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                    _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                                  FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+                }
+                /* The peer acknowledged no retransmission: Abort the connection */
+                else {
+                    _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                                  FSM_EVENT_TIMEOUT_ABORT, NULL, NULL, 0);
+                }
                 break;
 
             default:
@@ -368,6 +383,25 @@ void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_PACING)
+void _gnrc_tcp_eventloop_sched_pacing(gnrc_tcp_tcb_t *tcb, uint32_t offset)
+{
+    TCP_DEBUG_ENTER;
+    tcb->pacing_msg.type = MSG_TYPE_PACING;
+    tcb->pacing_msg.content.ptr = tcb;
+    ztimer_set_msg(ZTIMER_USEC, &tcb->pacing_timer, offset, &tcb->pacing_msg,
+                   _tcp_eventloop_pid);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_eventloop_unsched_pacing(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    ztimer_remove(ZTIMER_USEC, &tcb->pacing_timer);
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 int _gnrc_tcp_eventloop_init(void)
 {
     TCP_DEBUG_ENTER;
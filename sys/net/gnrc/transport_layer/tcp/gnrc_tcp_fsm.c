@@ -19,12 +19,14 @@
 
 #include <utlist.h>
 #include <errno.h>
+#include <string.h>
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,11 +94,21 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->snd_queue_num > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < tcb->snd_queue_num; i++) {
+            gnrc_pktbuf_release(tcb->snd_queue[i].pkt);
+        }
+        tcb->snd_queue_num = 0;
+    }
+#if IS_USED(MODULE_GNRC_TCP_PACING)
+    if (tcb->status & STATUS_PACING) {
+        _gnrc_tcp_eventloop_unsched_pacing(tcb);
     }
+#endif
+    tcb->status &= ~(STATUS_RTT_MEASURE | STATUS_RECOVERY | STATUS_PACING);
+    tcb->dup_acks = 0;
+    tcb->retries = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -148,8 +160,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and connection timeout */
             _clear_retransmit(tcb);
+            _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -159,8 +172,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_DELETE(list->head, tcb);
                 mutex_unlock(&list->lock);
 
-                /* Free potentially allocated receive buffer */
+                /* Free potentially allocated receive buffer and congestion control */
                 _gnrc_tcp_rcvbuf_release_buffer(tcb);
+                _gnrc_tcp_congure_release(tcb);
                 TCP_DEBUG_INFO("Connection closed");
             }
             /* Re-open connection as listenng */
@@ -174,8 +188,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_LISTEN:
-            /* Clear Accepted Status */
-            tcb->status &= ~(STATUS_ACCEPTED);
+            /* Clear Accepted and Aborted Status */
+            tcb->status &= ~(STATUS_ACCEPTED | STATUS_ABORTED);
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -258,7 +272,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
- *            -ENOMEM if receive buffer could not be allocated.
+ *            -ENOMEM if receive buffer or congestion control could not be allocated.
  *            -EADDRINUSE if given local port number is already in use.
  */
 static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
@@ -273,7 +287,17 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
+    /* Allocate congestion control, unless the user assigned one */
+    if (_gnrc_tcp_congure_get(tcb) == -ENOMEM) {
+        _gnrc_tcp_rcvbuf_release_buffer(tcb);
+        TCP_DEBUG_ERROR("-ENOMEM: Can't allocate congestion control.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
     tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_ooo_num = 0;
+    tcb->status &= ~STATUS_ABORTED;
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -294,11 +318,12 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         }
 
         /* Send SYN */
+        _gnrc_tcp_congure_init(tcb);
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN, tcb->iss, 0,
                             NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
     TCP_DEBUG_LEAVE;
@@ -308,36 +333,67 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Sends segments as long as the send window, the congestion window and the
+ * retransmission queue allow it. A segment smaller than the MSS is only sent
+ * if no data is in flight.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
  *
  * @returns   Number of successfully transmitted bytes.
+ *            -ENOMEM if no segment could be allocated while no data is in flight.
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while (sent < len && tcb->snd_queue_num < CONFIG_GNRC_TCP_SND_QUEUE_SIZE &&
+           !(tcb->status & STATUS_PACING)) {
+        uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+        uint32_t wnd = (in_flight < tcb->snd_wnd) ? tcb->snd_wnd - in_flight : 0;
+        uint32_t cwnd = _gnrc_tcp_congure_avail(tcb);
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t full = len - sent;
+        full = (full < CONFIG_GNRC_TCP_MSS) ? full : CONFIG_GNRC_TCP_MSS;
+        full = (full < tcb->mss) ? full : tcb->mss;
+        size_t payload = (full < wnd) ? full : wnd;
+        payload = (payload < cwnd) ? payload : cwnd;
+
+        /* Wait for ACKs instead of sending a small segment */
+        if (payload == 0 || (payload < full && in_flight > 0)) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            /* Without data in flight, no ACK frees packet buffer space */
+            if (sent == 0 && tcb->snd_queue_num == 0) {
+                TCP_DEBUG_ERROR("-ENOMEM: Can't allocate segment.");
+                TCP_DEBUG_LEAVE;
+                return -ENOMEM;
+            }
+            break;
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
+
+#if IS_USED(MODULE_GNRC_TCP_PACING)
+        /* Spread the segments over the round trip time */
+        uint32_t gap = _gnrc_tcp_congure_pacing_gap(tcb, payload);
+        if (gap > 0) {
+            tcb->status |= STATUS_PACING;
+            _gnrc_tcp_eventloop_sched_pacing(tcb, gap);
+        }
+#endif
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -382,6 +438,7 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
+ *            -EAGAIN if the FIN has to wait for room in the retransmission queue.
  */
 static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
 {
@@ -389,13 +446,18 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
 
     if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED ||
         tcb->state == FSM_STATE_CLOSE_WAIT) {
+        if (tcb->snd_queue_num >= CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+            TCP_DEBUG_INFO("Retransmission queue is full, FIN has to wait.");
+            TCP_DEBUG_LEAVE;
+            return -EAGAIN;
+        }
 
         /* Send FIN packet */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
                             tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
 
@@ -443,6 +505,202 @@ static int _fsm_call_abort(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Records a block of data received out of order.
+ *
+ * Overlapping and adjacent blocks are merged. The block holding the new data
+ * becomes the first one, as SACK reports it first. If all blocks are in use,
+ * the least recently updated one is forgotten and must be received again.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    First sequence number of the new data.
+ * @param[in]     right   Sequence number following the new data.
+ */
+static void _rcv_ooo_add(gnrc_tcp_tcb_t *tcb, uint32_t left, uint32_t right)
+{
+    gnrc_tcp_seq_block_t *blocks = tcb->rcv_ooo;
+    unsigned num = 0;
+
+    /* Merge into the new block, keep the order of the remaining ones */
+    for (unsigned i = 0; i < tcb->rcv_ooo_num; i++) {
+        if (LEQ_32_BIT(blocks[i].left, right) && LEQ_32_BIT(left, blocks[i].right)) {
+            if (LSS_32_BIT(blocks[i].left, left)) {
+                left = blocks[i].left;
+            }
+            if (LSS_32_BIT(right, blocks[i].right)) {
+                right = blocks[i].right;
+            }
+        }
+        else {
+            blocks[num++] = blocks[i];
+        }
+    }
+
+    if (num == CONFIG_GNRC_TCP_RCV_OOO_BLOCKS) {
+        num--;
+    }
+    memmove(&blocks[1], &blocks[0], num * sizeof(blocks[0]));
+    blocks[0].left = left;
+    blocks[0].right = right;
+    tcb->rcv_ooo_num = num + 1;
+}
+
+/**
+ * @brief Advances rcv_nxt over blocks received out of order that are no
+ *        longer separated from the in-order data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rcv_ooo_advance(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_seq_block_t *blocks = tcb->rcv_ooo;
+    unsigned num = 0;
+
+    /* Blocks neither overlap nor touch, so at most one can extend rcv_nxt */
+    for (unsigned i = 0; i < tcb->rcv_ooo_num; i++) {
+        if (LEQ_32_BIT(blocks[i].left, tcb->rcv_nxt)) {
+            if (LSS_32_BIT(tcb->rcv_nxt, blocks[i].right)) {
+                _gnrc_tcp_rcvbuf_commit(tcb, blocks[i].right - tcb->rcv_nxt);
+                tcb->rcv_nxt = blocks[i].right;
+            }
+        }
+        else {
+            blocks[num++] = blocks[i];
+        }
+    }
+    tcb->rcv_ooo_num = num;
+}
+
+/**
+ * @brief Stores the payload of an incoming segment in the receive buffer.
+ *
+ * Data that was already received is skipped and data that does not fit into
+ * the receive buffer is dropped. Data following a gap is kept in the receive
+ * buffer and becomes readable as soon as the gap is filled.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_seq   Sequence number of the incoming segment.
+ * @param[in]     snp       First payload snip of the incoming segment.
+ */
+static void _rcv_data(gnrc_tcp_tcb_t *tcb, uint32_t seg_seq, gnrc_pktsnip_t *snp)
+{
+    uint32_t seq = seg_seq;
+    uint32_t start = 0;
+    uint32_t len = 0;
+
+    /* Copy contents into receive buffer */
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        const uint8_t *data = snp->data;
+        size_t size = snp->size;
+
+        if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+            size_t skip = tcb->rcv_nxt - seq;
+            if (skip > size) {
+                skip = size;
+            }
+            data += skip;
+            size -= skip;
+            seq += skip;
+        }
+        if (size > 0) {
+            size_t written = _gnrc_tcp_rcvbuf_write(tcb, seq - tcb->rcv_nxt, data, size);
+
+            if (len == 0) {
+                start = seq;
+            }
+            len += written;
+            seq += written;
+            if (written < size) {
+                break;
+            }
+        }
+        snp = snp->next;
+    }
+
+    if (len == 0) {
+        return;
+    }
+    if (start == tcb->rcv_nxt) {
+        _gnrc_tcp_rcvbuf_commit(tcb, len);
+        tcb->rcv_nxt += len;
+        _rcv_ooo_advance(tcb);
+
+        /* Shrink receive window */
+        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+        /* Notify owner because new data is available */
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+    else {
+        _rcv_ooo_add(tcb, start, start + len);
+    }
+}
+
+/**
+ * @brief Loss recovery for an ACK of new data (NewReno, RFC 6582).
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_ack   Acknowledgment number of the incoming segment.
+ */
+static void _snd_new_ack(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack)
+{
+    tcb->dup_acks = 0;
+    if (!(tcb->status & STATUS_RECOVERY)) {
+        return;
+    }
+    /* Full ACK: All data sent before the loss was detected arrived */
+    if (tcb->snd_queue_num == 0 || LEQ_32_BIT(tcb->snd_recover, seg_ack)) {
+        tcb->status &= ~STATUS_RECOVERY;
+    }
+    /* Partial ACK: The segment following the acknowledged data was lost as well */
+    else if (!(tcb->snd_queue[0].flags & (SEG_SACKED | SEG_RETRANSMITTED))) {
+        _gnrc_tcp_pkt_retransmit(tcb, &tcb->snd_queue[0], false);
+    }
+}
+
+/**
+ * @brief Loss recovery for a duplicate ACK.
+ *
+ * The oldest segment is retransmitted after @ref DUP_ACK_THRESHOLD duplicate
+ * ACKs (RFC 5681, section 3.2). During recovery, every further duplicate ACK
+ * retransmits one segment the peer did not report with SACK, but a later one.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _snd_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks++;
+    }
+
+    if (!(tcb->status & STATUS_RECOVERY)) {
+        if (tcb->dup_acks >= DUP_ACK_THRESHOLD) {
+            tcb->status |= STATUS_RECOVERY;
+            tcb->snd_recover = tcb->snd_nxt;
+            _gnrc_tcp_congure_report_lost(tcb, &tcb->snd_queue[0]);
+            _gnrc_tcp_pkt_retransmit(tcb, &tcb->snd_queue[0], false);
+        }
+        return;
+    }
+
+    if (tcb->status & STATUS_SACK) {
+        unsigned end = tcb->snd_queue_num;
+
+        /* Only segments followed by selectively acknowledged ones are lost */
+        while (end > 0 && !(tcb->snd_queue[end - 1].flags & SEG_SACKED)) {
+            end--;
+        }
+        for (unsigned i = 0; i < end; i++) {
+            gnrc_tcp_snd_seg_t *seg = &tcb->snd_queue[i];
+
+            if (!(seg->flags & (SEG_SACKED | SEG_RETRANSMITTED))) {
+                _gnrc_tcp_congure_report_lost(tcb, seg);
+                _gnrc_tcp_pkt_retransmit(tcb, seg, false);
+                break;
+            }
+        }
+    }
+}
+
 /**
  * @brief FSM handling function for processing of an incoming TCP packet.
  *
@@ -463,13 +721,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_seq = 0;            /* Sequence number of the incoming packet*/
     uint32_t seg_ack = 0;            /* Acknowledgment number of the incoming packet */
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
+    _gnrc_tcp_option_sack_t sack;    /* SACK blocks of the incoming packet */
 
     /* Search for TCP header. */
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
+    if (_gnrc_tcp_option_parse(tcb, tcp_hdr, &sack) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
         TCP_DEBUG_LEAVE;
         return 0;
@@ -481,6 +740,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* The window in SYN segments is never scaled (RFC 7323, section 2.2) */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wscale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
@@ -569,15 +833,17 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->peer_port = src;
             tcb->irs = byteorder_ntohl(tcp_hdr->seq_num);
             tcb->rcv_nxt = tcb->irs + 1;
+            tcb->rcv_ooo_num = 0;
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
+            _gnrc_tcp_congure_init(tcb);
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
                                 tcb->rcv_nxt, NULL, 0);
-            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
             _transition_to(tcb, FSM_STATE_SYN_RCVD);
         }
@@ -612,6 +878,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         /* 3) Check SYN: Set TCB values accordingly */
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
+            tcb->rcv_ooo_num = 0;
             tcb->irs = seg_seq;
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
@@ -639,7 +906,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             else {
                 _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK,
                                     tcb->iss, tcb->rcv_nxt, NULL, 0);
-                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
                 _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 _transition_to(tcb, FSM_STATE_SYN_RCVD);
             }
@@ -652,7 +919,6 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     }
     /* Handle other states */
     else {
-        uint32_t seg_len = _gnrc_tcp_pkt_get_seg_len(in_pkt);
         uint32_t pay_len = _gnrc_tcp_pkt_get_pay_len(in_pkt);
         /* 1) Verify sequence number ... */
         if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
@@ -710,10 +976,22 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
+                /* Apply SACK blocks only if the acknowledgment is acceptable */
+                if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    for (unsigned i = 0; i < sack.num; i++) {
+                        _gnrc_tcp_pkt_sack(tcb, sack.blocks[i].left, sack.blocks[i].right);
+                    }
+                }
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _snd_new_ack(tcb, seg_ack);
+                }
+                /* Duplicate ACK (RFC 5681, section 2): Data behind snd_una arrived */
+                else if (seg_ack == tcb->snd_una && tcb->snd_queue_num > 0 && pay_len == 0 &&
+                         !(ctl & MSK_FIN) && seg_wnd == tcb->snd_wnd) {
+                    _snd_dup_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +1016,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,24 +1050,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-                    /* Notify owner because new data is available */
-                    tcb->status |= STATUS_NOTIFY_USER;
-                }
-                /* Send ACK, if FIN processing sends ACK already */
+                /* Store payload, also if it arrived out of order */
+                _rcv_data(tcb, seg_seq, gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF));
+
+                /* Send ACK, unless FIN processing sends ACK already. ACKs for
+                 * data following a gap carry SACK blocks if negotiated. */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -803,8 +1070,20 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Process FIN only after all data in front of it was received */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                if (pay_len == 0) {
+                    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                        tcb->rcv_nxt, NULL, 0);
+                    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                }
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
-            tcb->rcv_nxt = seg_seq + seg_len;
+            if (tcb->rcv_nxt == seg_seq + pay_len) {
+                tcb->rcv_nxt += 1;
+            }
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
                                 tcb->rcv_nxt, NULL, 0);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -813,7 +1092,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->snd_queue_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1136,27 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->snd_queue_num > 0) {
+        /* Retransmit the oldest segment now. Segments sent after it are
+         * retransmitted one by one with the following partial ACKs. The peer
+         * may have dropped data it reported with SACK (RFC 2018, section 8). */
+        _gnrc_tcp_congure_report_timeout(tcb);
+        for (unsigned i = 0; i < tcb->snd_queue_num; i++) {
+            tcb->snd_queue[i].flags &= ~(SEG_SACKED | SEG_RETRANSMITTED);
+        }
+        tcb->status |= STATUS_RECOVERY;
+        tcb->snd_recover = tcb->snd_nxt;
+        tcb->dup_acks = 0;
+
+        /* Abort the connection if the peer acknowledges nothing for the
+         * connection timeout. The handshake states have their own timeouts. */
+        if (tcb->retries == 0 && tcb->state != FSM_STATE_SYN_SENT &&
+            tcb->state != FSM_STATE_SYN_RCVD) {
+            _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
+                                      CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS,
+                                      MSG_TYPE_CONNECTION_TIMEOUT, tcb);
+        }
+        _gnrc_tcp_pkt_retransmit(tcb, &tcb->snd_queue[0], true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -868,6 +1165,23 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for pacing timeout handling.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_timeout_pacing(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Let a blocked send call continue */
+    tcb->status &= ~STATUS_PACING;
+    tcb->status |= STATUS_NOTIFY_USER;
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM handling function for connection timeout handling.
  *
@@ -883,6 +1197,23 @@ static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for retransmissions that were not acknowledged
+ *        within the connection timeout.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_timeout_abort(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    tcb->status |= STATUS_ABORTED;
+    _transition_to(tcb, FSM_STATE_CLOSED);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM handling function for probe sending.
  *
@@ -967,6 +1298,12 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_TIMEOUT_CONNECTION :
             ret = _fsm_timeout_connection(tcb);
             break;
+        case FSM_EVENT_TIMEOUT_PACING :
+            ret = _fsm_timeout_pacing(tcb);
+            break;
+        case FSM_EVENT_TIMEOUT_ABORT :
+            ret = _fsm_timeout_abort(tcb);
+            break;
         case FSM_EVENT_SEND_PROBE :
             ret = _fsm_send_probe(tcb);
             break;
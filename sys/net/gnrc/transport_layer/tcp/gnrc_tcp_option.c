@@ -16,15 +16,30 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, _gnrc_tcp_option_sack_t *sack)
 {
     TCP_DEBUG_ENTER;
+    sack->num = 0;
+
+    /* Window scaling and SACK are only negotiated by the SYN that opens a
+     * connection. Later SYNs must not change what was agreed on. */
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    bool negotiate = (ctl & MSK_SYN) &&
+                     ((tcb->state == FSM_STATE_LISTEN) || (tcb->state == FSM_STATE_SYN_SENT));
+    if (negotiate) {
+        tcb->status &= ~(STATUS_WSCALE | STATUS_SACK);
+        tcb->snd_wscale = 0;
+        tcb->rcv_wscale = 0;
+    }
+
     /* Extract offset value. Return if no options are set */
     uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
     if (offset <= TCP_HDR_OFFSET_MIN) {
@@ -64,6 +79,61 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Window scale option found.");
+                /* Only valid in SYN segments (RFC 7323, section 2.2) */
+                if (IS_ACTIVE(CONFIG_GNRC_TCP_WSCALE_EN) && negotiate) {
+                    tcb->status |= STATUS_WSCALE;
+                    tcb->snd_wscale = (option->value[0] < TCP_OPTION_WS_MAX) ?
+                                      option->value[0] : TCP_OPTION_WS_MAX;
+                    tcb->rcv_wscale = _gnrc_tcp_option_rcv_wscale();
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) && negotiate) {
+                    tcb->status |= STATUS_SACK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                if (tcb->status & STATUS_SACK) {
+                    for (uint8_t i = 0; i < option->length - TCP_OPTION_LENGTH_MIN &&
+                         sack->num < GNRC_TCP_OPTION_SACK_BLOCKS_MAX;
+                         i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        network_uint32_t left;
+                        network_uint32_t right;
+
+                        memcpy(&left, &option->value[i], sizeof(left));
+                        memcpy(&right, &option->value[i + sizeof(left)], sizeof(right));
+                        sack->blocks[sack->num].left = byteorder_ntohl(left);
+                        sack->blocks[sack->num].right = byteorder_ntohl(right);
+                        sack->num++;
+                    }
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -83,3 +153,75 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+uint8_t _gnrc_tcp_option_size(const gnrc_tcp_tcb_t *tcb, const uint16_t ctl)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t size = 0;
+
+    if (ctl & MSK_SYN) {
+        /* A SYN+ACK only confirms options the peer offered */
+        bool offer = !(ctl & MSK_ACK);
+
+        size += TCP_OPTION_LENGTH_MSS;
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_WSCALE_EN) && (offer || (tcb->status & STATUS_WSCALE))) {
+            size += 1 + TCP_OPTION_LENGTH_WS;
+        }
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) && (offer || (tcb->status & STATUS_SACK))) {
+            size += 2 + TCP_OPTION_LENGTH_SACK_PERM;
+        }
+    }
+    else if ((ctl & MSK_ACK) && !(ctl & MSK_RST) && (tcb->status & STATUS_SACK) &&
+             tcb->rcv_ooo_num > 0) {
+        size += 2 + TCP_OPTION_LENGTH_MIN +
+                _gnrc_tcp_option_sack_blocks(tcb) * TCP_OPTION_LENGTH_SACK_BLOCK;
+    }
+    TCP_DEBUG_LEAVE;
+    return size;
+}
+
+void _gnrc_tcp_option_build(const gnrc_tcp_tcb_t *tcb, const uint16_t ctl, uint8_t *opt_ptr)
+{
+    TCP_DEBUG_ENTER;
+    if (ctl & MSK_SYN) {
+        bool offer = !(ctl & MSK_ACK);
+        network_uint32_t mss_option = byteorder_htonl(
+            _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
+
+        memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+        opt_ptr += sizeof(mss_option);
+
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_WSCALE_EN) && (offer || (tcb->status & STATUS_WSCALE))) {
+            *opt_ptr++ = TCP_OPTION_KIND_NOP;
+            *opt_ptr++ = TCP_OPTION_KIND_WS;
+            *opt_ptr++ = TCP_OPTION_LENGTH_WS;
+            *opt_ptr++ = _gnrc_tcp_option_rcv_wscale();
+        }
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) && (offer || (tcb->status & STATUS_SACK))) {
+            *opt_ptr++ = TCP_OPTION_KIND_NOP;
+            *opt_ptr++ = TCP_OPTION_KIND_NOP;
+            *opt_ptr++ = TCP_OPTION_KIND_SACK_PERM;
+            *opt_ptr++ = TCP_OPTION_LENGTH_SACK_PERM;
+        }
+    }
+    else if ((ctl & MSK_ACK) && !(ctl & MSK_RST) && (tcb->status & STATUS_SACK) &&
+             tcb->rcv_ooo_num > 0) {
+        unsigned blocks = _gnrc_tcp_option_sack_blocks(tcb);
+
+        *opt_ptr++ = TCP_OPTION_KIND_NOP;
+        *opt_ptr++ = TCP_OPTION_KIND_NOP;
+        *opt_ptr++ = TCP_OPTION_KIND_SACK;
+        *opt_ptr++ = TCP_OPTION_LENGTH_MIN + blocks * TCP_OPTION_LENGTH_SACK_BLOCK;
+
+        /* The first block holds the most recently received segment (RFC 2018, section 4) */
+        for (unsigned i = 0; i < blocks; i++) {
+            network_uint32_t edge = byteorder_htonl(tcb->rcv_ooo[i].left);
+            memcpy(opt_ptr, &edge, sizeof(edge));
+            opt_ptr += sizeof(edge);
+            edge = byteorder_htonl(tcb->rcv_ooo[i].right);
+            memcpy(opt_ptr, &edge, sizeof(edge));
+            opt_ptr += sizeof(edge);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
@@ -25,6 +25,7 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -49,6 +50,39 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Keeps the retransmission timeout within its configured bounds.
+ *
+ * @param[in,out] tcb   TCB holding the retransmission timeout.
+ */
+static void _bound_rto(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
+/**
+ * @brief Calculates the retransmission timeout from the round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the round trip time estimation.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without a measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+    _bound_rto(tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -173,14 +207,14 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
+    /* The window in SYN segments is never scaled (RFC 7323, section 2.2) */
+    uint32_t wnd = (ctl & MSK_SYN) ? tcb->rcv_wnd : (tcb->rcv_wnd >> tcb->rcv_wscale);
+    tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
-    /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
-    if (ctl & MSK_SYN) {
-        offset += 1;
-    }
+    /* Calculate option field size, padded to full words */
+    offset += (_gnrc_tcp_option_size(tcb, ctl) + sizeof(network_uint32_t) - 1) /
+              sizeof(network_uint32_t);
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -211,15 +245,8 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
-            if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(
-                    _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
-
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
-            }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
+            /* Add MSS, window scale and SACK options as applicable */
+            _gnrc_tcp_option_build(tcb, ctl, opt_ptr);
         }
         *(out_pkt) = tcp_snp;
     }
@@ -285,14 +312,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
-    }
-    else {
-        tcb->retries += 1;
     }
 
     /* Pass packet down the network stack */
@@ -376,11 +398,11 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit)
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
 {
     TCP_DEBUG_ENTER;
     gnrc_pktsnip_t *snp = NULL;
+    gnrc_tcp_snd_seg_t *seg = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
 
@@ -391,13 +413,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     if (snp == NULL) {
@@ -415,23 +430,57 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Check if retransmit queue is full */
+    if (tcb->snd_queue_num >= CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
+    /* Append pkt and increase users: every send attempt consumes a user */
+    seg = &tcb->snd_queue[tcb->snd_queue_num++];
+    seg->pkt = pkt;
+    seg->seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    seg->len = _gnrc_tcp_pkt_get_seg_len(pkt);
+    seg->flags = 0;
     gnrc_pktbuf_hold(pkt, 1);
+    _gnrc_tcp_congure_report_sent(tcb, seg, len);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* Measure round trip time with this segment, if no measurement is running */
+    if (!(tcb->status & STATUS_RTT_MEASURE)) {
+        tcb->status |= STATUS_RTT_MEASURE;
+        tcb->rtt_seq = seg->seq;
+        tcb->rtt_start = evtimer_now_msec();
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
+
+    /* The retransmission timer runs for the oldest segment only */
+    if (tcb->snd_queue_num == 1) {
+        _calc_rto(tcb);
+
+        /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_tcp_snd_seg_t *seg, const bool timeout)
+{
+    TCP_DEBUG_ENTER;
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(seg->pkt, 1);
+    seg->flags |= SEG_RETRANSMITTED;
+    _gnrc_tcp_congure_report_resent(seg);
+
+    /* An ACK can't be matched to a transmission anymore (Karns Algorithm) */
+    tcb->status &= ~STATUS_RTT_MEASURE;
+
+    if (timeout) {
+        /* Double the rto (Timer Backoff) */
+        if (tcb->retries < UINT8_MAX) {
+            tcb->retries += 1;
+        }
         tcb->rto *= 2;
 
         /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
@@ -440,61 +489,48 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        _bound_rto(tcb);
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
     }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return _gnrc_tcp_pkt_send(tcb, seg->pkt, 0, true);
 }
 
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned num = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->snd_queue_num == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
+    /* Segments are queued in sequence order, release all that were acknowledged completely */
+    while (num < tcb->snd_queue_num &&
+           LEQ_32_BIT(tcb->snd_queue[num].seq + tcb->snd_queue[num].len, ack)) {
+        num++;
     }
+    _gnrc_tcp_congure_report_acked(tcb, num, ack);
+    for (unsigned i = 0; i < num; i++) {
+        gnrc_pktbuf_release(tcb->snd_queue[i].pkt);
+    }
+    tcb->snd_queue_num -= num;
+    memmove(&tcb->snd_queue[0], &tcb->snd_queue[num],
+            tcb->snd_queue_num * sizeof(tcb->snd_queue[0]));
 
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
-
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_MEASURE) && LSS_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_MEASURE;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -507,12 +543,43 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
                 tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
                 tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
             }
+            _calc_rto(tcb);
         }
     }
+
+    /* New data was acknowledged: restart timer for the remaining segments */
+    if (tcb->retries > 0) {
+        /* The peer is alive, stop the connection timeout of the retransmissions */
+        _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+        tcb->retries = 0;
+    }
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->snd_queue_num > 0) {
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+
+    /* Notify user, room for further segments is available */
+    if (num > 0) {
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->snd_queue_num; i++) {
+        gnrc_tcp_snd_seg_t *seg = &tcb->snd_queue[i];
+
+        if (LEQ_32_BIT(left, seg->seq) && LEQ_32_BIT(seg->seq + seg->len, right)) {
+            seg->flags |= SEG_SACKED;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
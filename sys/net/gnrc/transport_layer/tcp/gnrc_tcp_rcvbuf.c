@@ -18,6 +18,8 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "assert.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -124,3 +126,39 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+size_t _gnrc_tcp_rcvbuf_write(gnrc_tcp_tcb_t *tcb, size_t offset, const void *data,
+                              size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    size_t space = ringbuffer_get_free(rb);
+
+    /* Only the free part of the buffer can be written */
+    if (offset >= space) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (len > space - offset) {
+        len = space - offset;
+    }
+
+    /* Copy behind the readable data, wrapping around at the end of the buffer */
+    size_t pos = (rb->start + rb->avail + offset) % rb->size;
+    size_t first = rb->size - pos;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(rb->buf + pos, data, first);
+    memcpy(rb->buf, (const uint8_t *)data + first, len - first);
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+
+void _gnrc_tcp_rcvbuf_commit(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    assert(len <= ringbuffer_get_free(&tcb->rcv_buf));
+    tcb->rcv_buf.avail += len;
+    TCP_DEBUG_LEAVE;
+}
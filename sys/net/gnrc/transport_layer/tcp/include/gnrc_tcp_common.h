@@ -46,6 +46,22 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_WSCALE         (1 << 5) /**< Internal: Status bitmask window scaling in use */
+#define STATUS_SACK           (1 << 6) /**< Internal: Status bitmask SACK in use */
+#define STATUS_RTT_MEASURE    (1 << 7) /**< Internal: Status bitmask rtt_seq is timed */
+#define STATUS_RECOVERY       (1 << 8) /**< Internal: Status bitmask loss recovery */
+#define STATUS_CONGURE_POOL   (1 << 9) /**< Internal: Status bitmask congure from pool */
+#define STATUS_PACING         (1 << 10) /**< Internal: Status bitmask pacing timer running */
+#define STATUS_ABORTED        (1 << 11) /**< Internal: Status bitmask retransmissions timed out */
+/** @} */
+
+/**
+ * @brief Retransmission state of a segment in the send queue.
+ * @{
+ */
+#define SEG_SACKED            (1 << 0) /**< Internal: Segment was selectively acknowledged */
+#define SEG_RETRANSMITTED     (1 << 1) /**< Internal: Segment was retransmitted */
+#define SEG_LOST              (1 << 2) /**< Internal: Segment was reported lost */
 /** @} */
 
 /**
@@ -85,8 +101,14 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_PACING             (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (RFC 5681).
+ */
+#define DUP_ACK_THRESHOLD (3U)
+
 /**
  * @brief Define for marking that time measurement is uninitialized.
  */
@@ -0,0 +1,306 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Glue between the send queue and the congestion control.
+ *
+ * Only the payload of data segments is reported to the congestion control.
+ * A segment reported lost no longer counts as in flight, also not after it
+ * was retransmitted. This keeps the bytes in flight as seen by CongURE equal
+ * to what is reported acknowledged later on.
+ *
+ * Without module `gnrc_tcp_congure`, one data segment is sent at a time.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "modules.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "net/gnrc/tcp/congure_snd.h"
+#include "gnrc_tcp_common.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "timex.h"
+#include "ztimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Largest congestion window. Acknowledgments grow the window by at most
+ *        one MSS, so it can not wrap around.
+ */
+#define GNRC_TCP_CONGURE_CWND_MAX   (CONGURE_WND_SIZE_MAX - CONFIG_GNRC_TCP_MSS)
+
+/**
+ * @brief Assigns a CongURE state object from the pool, unless the user
+ *        assigned one to the connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if no CongURE state object is available.
+ */
+static inline int _gnrc_tcp_congure_get(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    if (tcb->congure == NULL) {
+        tcb->congure = gnrc_tcp_congure_snd_get();
+        if (tcb->congure == NULL) {
+            return -ENOMEM;
+        }
+        tcb->status |= STATUS_CONGURE_POOL;
+    }
+#else
+    (void)tcb;
+#endif
+    return 0;
+}
+
+/**
+ * @brief Returns a CongURE state object taken from the pool.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static inline void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    if (tcb->status & STATUS_CONGURE_POOL) {
+        gnrc_tcp_congure_snd_free(tcb->congure);
+        tcb->congure = NULL;
+        tcb->status &= ~STATUS_CONGURE_POOL;
+    }
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Initializes the congestion control for a new connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    tcb->congure->driver->init(tcb->congure, tcb);
+    if (tcb->congure->cwnd > GNRC_TCP_CONGURE_CWND_MAX) {
+        tcb->congure->cwnd = GNRC_TCP_CONGURE_CWND_MAX;
+    }
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Calculates how many bytes the congestion window allows to send.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that can be sent.
+ */
+static inline uint32_t _gnrc_tcp_congure_avail(const gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    uint32_t in_flight = 0;
+
+    for (unsigned i = 0; i < tcb->snd_queue_num; i++) {
+        if (!(tcb->snd_queue[i].flags & SEG_LOST)) {
+            in_flight += tcb->snd_queue[i].msg.size;
+        }
+    }
+    return (in_flight < tcb->congure->cwnd) ? tcb->congure->cwnd - in_flight : 0;
+#else
+    return (tcb->snd_una == tcb->snd_nxt) ? UINT32_MAX : 0;
+#endif
+}
+
+/**
+ * @brief Reports a segment sent for the first time.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in,out] seg    Segment that was sent.
+ * @param[in]     size   Payload size of @p seg.
+ */
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, gnrc_tcp_snd_seg_t *seg,
+                                                 uint16_t size)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    seg->msg.send_time = ztimer_now(ZTIMER_MSEC);
+    seg->msg.size = size;
+    seg->msg.resends = 0;
+    if (size > 0) {
+        tcb->congure->driver->report_msg_sent(tcb->congure, size);
+    }
+#else
+    (void)tcb;
+    (void)seg;
+    (void)size;
+#endif
+}
+
+/**
+ * @brief Records the retransmission of a segment.
+ *
+ * @param[in,out] seg   Segment that was retransmitted.
+ */
+static inline void _gnrc_tcp_congure_report_resent(gnrc_tcp_snd_seg_t *seg)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    seg->msg.send_time = ztimer_now(ZTIMER_MSEC);
+    if (seg->msg.resends < UINT8_MAX) {
+        seg->msg.resends++;
+    }
+#else
+    (void)seg;
+#endif
+}
+
+/**
+ * @brief Reports the first @p num segments of the send queue as acknowledged.
+ *
+ * The segments are reported as one message, as CongURE expects one report per
+ * acknowledgment. The acknowledgment is identified relative to the initial
+ * sequence number: Reno starts with the largest ID as last ACK, so raw
+ * acknowledgment numbers from the upper half of the sequence number space
+ * would never count as new ones.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     num   Number of acknowledged segments.
+ * @param[in]     ack   Acknowledgment number.
+ */
+static inline void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, unsigned num,
+                                                  uint32_t ack)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t msg = { 0 };
+    congure_snd_ack_t ack_info = {
+        .recv_time = ztimer_now(ZTIMER_MSEC),
+        .id = ack - tcb->iss,
+        .clean = true,
+    };
+    bool data = false;
+
+    for (unsigned i = 0; i < num; i++) {
+        const gnrc_tcp_snd_seg_t *seg = &tcb->snd_queue[i];
+
+        if (seg->msg.size == 0) {
+            continue;
+        }
+        data = true;
+        msg.send_time = seg->msg.send_time;
+        if (msg.resends < seg->msg.resends) {
+            msg.resends = seg->msg.resends;
+        }
+        if (!(seg->flags & SEG_LOST)) {
+            msg.size += seg->msg.size;
+        }
+    }
+    if (data) {
+        congure_wnd_size_t cwnd = tcb->congure->cwnd;
+
+        tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &ack_info);
+        /* Acknowledgments never shrink the window, a smaller one wrapped around */
+        if ((tcb->congure->cwnd < cwnd) || (tcb->congure->cwnd > GNRC_TCP_CONGURE_CWND_MAX)) {
+            tcb->congure->cwnd = GNRC_TCP_CONGURE_CWND_MAX;
+        }
+    }
+#else
+    (void)tcb;
+    (void)num;
+    (void)ack;
+#endif
+}
+
+/**
+ * @brief Reports a segment as lost, e.g. after duplicate acknowledgments.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in,out] seg   Lost segment.
+ */
+static inline void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb, gnrc_tcp_snd_seg_t *seg)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t lost = { 0 };
+
+    if ((seg->msg.size > 0) && !(seg->flags & SEG_LOST)) {
+        seg->flags |= SEG_LOST;
+        clist_rpush(&lost.super, &seg->msg.super);
+        tcb->congure->driver->report_msgs_lost(tcb->congure, &lost);
+    }
+#else
+    (void)tcb;
+    (void)seg;
+#endif
+}
+
+/**
+ * @brief Reports all segments in flight as timed out.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static inline void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_msg_t timeout = { 0 };
+
+    for (unsigned i = 0; i < tcb->snd_queue_num; i++) {
+        gnrc_tcp_snd_seg_t *seg = &tcb->snd_queue[i];
+
+        if ((seg->msg.size > 0) && !(seg->flags & SEG_LOST)) {
+            seg->flags |= SEG_LOST;
+            clist_rpush(&timeout.super, &seg->msg.super);
+        }
+    }
+    tcb->congure->driver->report_msgs_timeout(tcb->congure, &timeout);
+#else
+    (void)tcb;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_TCP_PACING) || defined(DOXYGEN)
+/**
+ * @brief Calculates the gap to keep after sending a data segment.
+ *
+ * The gap is the inter-message interval of the congestion control. If it
+ * does not provide one, the congestion window is spread over 4/5 of the
+ * smoothed round trip time. @ref CONFIG_GNRC_TCP_PACING_MIN_GAP_US is the
+ * lower bound.
+ *
+ * @param[in] tcb    TCB holding the connection information.
+ * @param[in] size   Payload size of the segment sent.
+ *
+ * @returns   Gap in microseconds.
+ */
+static inline uint32_t _gnrc_tcp_congure_pacing_gap(const gnrc_tcp_tcb_t *tcb, uint16_t size)
+{
+    int32_t gap = tcb->congure->driver->inter_msg_interval(tcb->congure, size);
+
+    if ((gap < 0) && (tcb->srtt > 0) && (tcb->congure->cwnd > 0)) {
+        gap = ((uint64_t)4 * tcb->srtt * US_PER_MS * size) / (5U * tcb->congure->cwnd);
+    }
+    if (gap < (int32_t)CONFIG_GNRC_TCP_PACING_MIN_GAP_US) {
+        gap = CONFIG_GNRC_TCP_PACING_MIN_GAP_US;
+    }
+    return gap;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
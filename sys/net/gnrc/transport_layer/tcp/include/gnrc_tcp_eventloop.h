@@ -22,6 +22,8 @@
 #include <stdint.h>
 
 #include "evtimer_msg.h"
+#include "modules.h"
+#include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -57,6 +59,26 @@ void _gnrc_tcp_eventloop_sched(evtimer_msg_event_t *event, uint32_t offset,
  */
 void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event);
 
+#if IS_USED(MODULE_GNRC_TCP_PACING) || defined(DOXYGEN)
+/**
+ * @brief   Schedule the pacing timer of a connection to the event loop
+ *
+ * @param[in] tcb       TCB holding the pacing timer
+ * @param[in] offset    Offset in microseconds when the next data segment
+ *                      may be sent
+ */
+void _gnrc_tcp_eventloop_sched_pacing(gnrc_tcp_tcb_t *tcb, uint32_t offset);
+
+/**
+ * @brief   Unschedule the pacing timer of a connection
+ *
+ * Does nothing if the pacing timer of @p tcb was not scheduled.
+ *
+ * @param[in] tcb       TCB holding the pacing timer
+ */
+void _gnrc_tcp_eventloop_unsched_pacing(gnrc_tcp_tcb_t *tcb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "assert.h"
 #include "net/tcp.h"
@@ -41,6 +42,48 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * Without the timestamp option, four blocks fit into the option space.
+ */
+#define GNRC_TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief SACK blocks of an incoming segment.
+ *
+ * The blocks are collected while parsing the options and only applied after
+ * the acknowledgment of the segment was found to be acceptable.
+ */
+typedef struct {
+    gnrc_tcp_seq_block_t blocks[GNRC_TCP_OPTION_SACK_BLOCKS_MAX]; /**< Received blocks */
+    uint8_t num;                                                  /**< Number of blocks */
+} _gnrc_tcp_option_sack_t;
+
+/**
+ * @brief Helper function to get the shift count of the announced receive window.
+ * @returns   Smallest shift count that fits the receive buffer size into 16 bit.
+ */
+static inline uint8_t _gnrc_tcp_option_rcv_wscale(void)
+{
+    uint8_t shift = 0;
+    while (((uint32_t) GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
+/**
+ * @brief Helper function to get the number of blocks to report in a SACK option.
+ * @param[in] tcb   TCB holding the connection information.
+ * @returns   Number of blocks.
+ */
+static inline unsigned _gnrc_tcp_option_sack_blocks(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->rcv_ooo_num < GNRC_TCP_OPTION_SACK_BLOCKS_MAX) ?
+           tcb->rcv_ooo_num : GNRC_TCP_OPTION_SACK_BLOCKS_MAX;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -58,13 +101,30 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     hdr   TCP header to be parsed.
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     hdr    TCP header to be parsed.
+ * @param[out]    sack   SACK blocks found in the header.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, _gnrc_tcp_option_sack_t *sack);
+
+/**
+ * @brief Calculates the size of the options of an outgoing segment.
+ * @param[in] tcb   TCB holding the connection information.
+ * @param[in] ctl   Control bits of the segment.
+ * @returns   Size of the options in bytes, excluding padding.
+ */
+uint8_t _gnrc_tcp_option_size(const gnrc_tcp_tcb_t *tcb, const uint16_t ctl);
+
+/**
+ * @brief Writes the options of an outgoing segment.
+ * @param[in]  tcb       TCB holding the connection information.
+ * @param[in]  ctl       Control bits of the segment.
+ * @param[out] opt_ptr   Option field, at least _gnrc_tcp_option_size() bytes.
+ */
+void _gnrc_tcp_option_build(const gnrc_tcp_tcb_t *tcb, const uint16_t ctl, uint8_t *opt_ptr);
 
 #ifdef __cplusplus
 }
@@ -110,19 +110,32 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
- * @param[in,out] tcb          TCB holding the connection information.
- * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * Segments are queued in sequence order. The retransmission timer is
+ * started, if @p pkt is the only segment waiting for an acknowledgment.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Packet to add to the retransmission mechanism.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
  *            -EINVAL if pkt is null.
  */
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit);
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Retransmits a segment from the retransmission queue.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in,out] seg       Segment to retransmit.
+ * @param[in]     timeout   Flag to mark that the retransmission timer expired.
+ *                          The timer is backed off and restarted.
+ *
+ * @returns   Zero on success.
+ */
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_tcp_snd_seg_t *seg, const bool timeout);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -132,6 +145,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks segments covered by a SACK block as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    First sequence number of the block.
+ * @param[in]     right   Sequence number following the block.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
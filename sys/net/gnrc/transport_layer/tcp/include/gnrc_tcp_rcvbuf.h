@@ -47,6 +47,29 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Write data into the free part of the receive buffer.
+ *
+ * The data is not readable until it is committed with
+ * _gnrc_tcp_rcvbuf_commit(). This allows storing segments received out of
+ * order at their place in the stream.
+ *
+ * @param[in,out] tcb      TCB holding the receive buffer.
+ * @param[in]     offset   Position relative to the end of the readable data.
+ * @param[in]     data     Data to write.
+ * @param[in]     len      Number of bytes in @p data.
+ * @returns   Number of bytes written, less than @p len if the buffer is full.
+ */
+size_t _gnrc_tcp_rcvbuf_write(gnrc_tcp_tcb_t *tcb, size_t offset, const void *data,
+                              size_t len);
+
+/**
+ * @brief Make written data readable.
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     len   Number of bytes following the readable data to commit.
+ */
+void _gnrc_tcp_rcvbuf_commit(gnrc_tcp_tcb_t *tcb, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
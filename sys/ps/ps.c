@@ -30,6 +30,10 @@
 #include "ztimer.h"
 #endif
 
+#ifdef MODULE_SCHED_LATENCY
+#include "sched_latency.h"
+#endif
+
 #ifdef MODULE_TLSF_MALLOC
 #include "tlsf.h"
 #include "tlsf-malloc.h"
@@ -149,4 +153,8 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+#ifdef MODULE_SCHED_LATENCY
+    puts("\nScheduler latency:");
+    sched_latency_print();
+#endif
 }
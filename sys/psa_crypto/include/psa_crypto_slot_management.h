@@ -185,13 +185,29 @@ static inline int psa_key_lifetime_is_external(psa_key_lifetime_t lifetime)
 /**
  * @brief   Wipe volatile key slot and its contents. Wiped key slots can be reused.
  *
- * @param   slot    Pointer to the key slot to be wiped
+ * @param   slot    Pointer to the key slot to be wiped, locked at most by the caller
  *
  * @return  @ref PSA_SUCCESS
  * @return  @ref PSA_ERROR_DOES_NOT_EXIST
+ * @return  @ref PSA_ERROR_CORRUPTION_DETECTED  The slot is still in use by others
  */
 psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot);
 
+/**
+ * @brief   Destroy the key in a slot, including its copy in persistent storage, and wipe the slot.
+ *
+ *          Checking that no one else uses the key and destroying it happen atomically.
+ *
+ * @param   slot    Pointer to the key slot to be destroyed, locked once by the caller. The lock
+ *                  is released in any case.
+ *
+ * @return  @ref PSA_SUCCESS
+ * @return  @ref PSA_ERROR_DOES_NOT_EXIST
+ * @return  @ref PSA_ERROR_CORRUPTION_DETECTED  The key is still in use by others
+ * @return  @ref PSA_ERROR_STORAGE_FAILURE
+ */
+psa_status_t psa_destroy_key_slot(psa_key_slot_t *slot);
+
 /**
  * @brief   Wipe all existing volatile key slots.
  */
@@ -200,6 +216,9 @@ void psa_wipe_all_key_slots(void);
 /**
  * @brief   Find a key slot in local memory and lock it.
  *
+ *          Several callers can hold the lock of a slot at the same time. A locked slot is neither
+ *          wiped by @ref psa_wipe_key_slot nor evicted to make room for another key.
+ *
  * @param   id      ID of the key to be used
  * @param   slot    Pointer to the slot the key is stored in
  *
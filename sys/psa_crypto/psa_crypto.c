@@ -1300,22 +1300,8 @@ psa_status_t psa_destroy_key(psa_key_id_t key)
     if (status != PSA_SUCCESS) {
         return status;
     }
-    if (slot->lock_count > 1) {
-        return PSA_ERROR_CORRUPTION_DETECTED;
-    }
-
-#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
-    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) {
-        status = psa_destroy_persistent_key(key);
-        if (status != PSA_SUCCESS) {
-            DEBUG("PSA destroy key: Persistent key destruction failed: %s\n",
-                                            psa_status_to_humanly_readable(status));
-            return PSA_ERROR_STORAGE_FAILURE;
-        }
-    }
-#endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
-    return psa_wipe_key_slot(slot);
+    return psa_destroy_key_slot(slot);
 }
 
 /**
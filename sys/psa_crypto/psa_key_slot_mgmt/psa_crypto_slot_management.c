@@ -19,6 +19,7 @@
  */
 
 #include "clist.h"
+#include "mutex.h"
 #include "psa_crypto_slot_management.h"
 #include "architecture.h"
 
@@ -93,6 +94,54 @@ static clist_node_t key_slot_list;
  */
 static psa_key_id_t key_id_count = PSA_KEY_ID_VOLATILE_MIN;
 
+/**
+ * @brief   Number of entries in the key ID index. At most half of them are
+ *          used, which keeps the probe sequences short.
+ */
+#define KEY_INDEX_SIZE      (2 * PSA_KEY_SLOT_COUNT + 1)
+
+/**
+ * @brief   Entry of the key ID index
+ */
+typedef struct {
+    psa_key_slot_t *slot;   /**< Slot allocated for the key, NULL if unused */
+    psa_key_id_t id;        /**< ID of the key */
+    uint32_t last_use;      /**< Value of @ref key_use_count at the last lookup */
+} key_index_entry_t;
+
+/**
+ * @brief   Key ID index over all used key slots, using linear probing
+ */
+static key_index_entry_t key_index[KEY_INDEX_SIZE];
+
+/**
+ * @brief   Counter of key lookups, used to find the least recently used
+ *          persistent key when a slot has to be freed
+ */
+static uint32_t key_use_count;
+
+/**
+ * @brief   Protects the slot lists, the key ID index and the lock counts of
+ *          the slots with module `psa_key_slot_mgmt_thread_safe`
+ *
+ *          The functions without `psa_` prefix expect the caller to hold it.
+ */
+static mutex_t slot_lock = MUTEX_INIT;
+
+static inline void slot_mgmt_lock(void)
+{
+    if (IS_USED(MODULE_PSA_KEY_SLOT_MGMT_THREAD_SAFE)) {
+        mutex_lock(&slot_lock);
+    }
+}
+
+static inline void slot_mgmt_unlock(void)
+{
+    if (IS_USED(MODULE_PSA_KEY_SLOT_MGMT_THREAD_SAFE)) {
+        mutex_unlock(&slot_lock);
+    }
+}
+
 /**
  * @brief   Get the correct empty slot list, depending on the key type
  *
@@ -120,6 +169,9 @@ static clist_node_t * psa_get_empty_key_slot_list(const psa_key_attributes_t *at
 
 void psa_init_key_slots(void)
 {
+    memset(key_index, 0, sizeof(key_index));
+    key_use_count = 0;
+
 #if PSA_PROTECTED_KEY_COUNT
     memset(protected_key_slots, 0, sizeof(protected_key_slots));
 
@@ -187,7 +239,73 @@ static void psa_wipe_real_slot_type(psa_key_slot_t *slot)
 #endif
 }
 
-psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
+static unsigned key_index_hash(psa_key_id_t id)
+{
+    uint32_t h = id * 0x9e3779b1;
+
+    return (h ^ (h >> 16)) % KEY_INDEX_SIZE;
+}
+
+/**
+ * @brief   Find the index entry of a key
+ *
+ * @param   id  ID of the key
+ *
+ * @return  Pointer to the entry, NULL if the ID is not in the index
+ */
+static key_index_entry_t *key_index_find(psa_key_id_t id)
+{
+    /* The index never fills up, so every probe sequence ends at an unused entry */
+    for (unsigned i = key_index_hash(id); key_index[i].slot != NULL;
+         i = (i + 1) % KEY_INDEX_SIZE) {
+        if (key_index[i].id == id) {
+            return &key_index[i];
+        }
+    }
+    return NULL;
+}
+
+static void key_index_add(psa_key_id_t id, psa_key_slot_t *slot)
+{
+    unsigned i = key_index_hash(id);
+
+    while (key_index[i].slot != NULL) {
+        i = (i + 1) % KEY_INDEX_SIZE;
+    }
+    key_index[i].slot = slot;
+    key_index[i].id = id;
+    key_index[i].last_use = key_use_count;
+}
+
+static void key_index_remove(const psa_key_slot_t *slot)
+{
+    unsigned i = 0;
+
+    while (key_index[i].slot != slot) {
+        if (++i == KEY_INDEX_SIZE) {
+            return;
+        }
+    }
+
+    /* Move up entries behind the gap, unless their probe sequence starts
+     * after it. Otherwise a lookup would stop at the gap. */
+    for (unsigned j = i;;) {
+        unsigned home;
+
+        key_index[i].slot = NULL;
+        do {
+            j = (j + 1) % KEY_INDEX_SIZE;
+            if (key_index[j].slot == NULL) {
+                return;
+            }
+            home = key_index_hash(key_index[j].id);
+        } while ((i <= j) ? ((i < home) && (home <= j)) : ((i < home) || (home <= j)));
+        key_index[i] = key_index[j];
+        i = j;
+    }
+}
+
+static psa_status_t wipe_key_slot(psa_key_slot_t *slot)
 {
     /* Get list the slot is stored in */
     clist_node_t *empty_list = psa_get_empty_key_slot_list(&slot->attr);
@@ -205,6 +323,8 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
 
     psa_key_slot_t *tmp = container_of(n, psa_key_slot_t, node);
 
+    key_index_remove(tmp);
+
     /* Wipe slot associated with node */
     psa_wipe_real_slot_type(tmp);
 
@@ -213,8 +333,51 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
     return PSA_SUCCESS;
 }
 
+psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+    slot_mgmt_lock();
+    /* Only the caller may still use the key */
+    if (slot->lock_count <= 1) {
+        status = wipe_key_slot(slot);
+    }
+    slot_mgmt_unlock();
+    return status;
+}
+
+psa_status_t psa_destroy_key_slot(psa_key_slot_t *slot)
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+    slot_mgmt_lock();
+    /* Only the caller may still use the key, otherwise just release its lock */
+    if (slot->lock_count > 1) {
+        slot->lock_count--;
+        slot_mgmt_unlock();
+        return status;
+    }
+
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) {
+        status = psa_destroy_persistent_key(slot->attr.id);
+        if (status != PSA_SUCCESS) {
+            DEBUG("[psa_crypto_slot_mgmt] destroy key: persistent key destruction failed\n");
+            slot->lock_count--;
+            slot_mgmt_unlock();
+            return PSA_ERROR_STORAGE_FAILURE;
+        }
+    }
+#endif /* MODULE_PSA_PERSISTENT_STORAGE */
+
+    status = wipe_key_slot(slot);
+    slot_mgmt_unlock();
+    return status;
+}
+
 void psa_wipe_all_key_slots(void)
 {
+    slot_mgmt_lock();
     /* Move all list items to empty lists */
     while (!clist_is_empty(&key_slot_list)) {
         clist_node_t *to_remove = clist_rpop(&key_slot_list);
@@ -224,50 +387,24 @@ void psa_wipe_all_key_slots(void)
         psa_wipe_real_slot_type(slot);
         clist_rpush(empty_list, to_remove);
     }
+    memset(key_index, 0, sizeof(key_index));
+    slot_mgmt_unlock();
 }
 
-/**
- * @brief   Check whether a given key ID equals the ID of the given node.
- *
- *          This is the break condition of the @ref clist_foreach function used
- *          in @ref psa_get_and_lock_key_slot_in_memory.
- *          clist_foreach iterates over all key slots and calls this function
- *          to compare each slot's key ID to the given input key ID.
- *          If they are equal, this function returns True and breaks the foreach
- *          loop.
- *
- *          For more information see core/lib/include/clist.h.
- *
- * @param   n   Pointer to clist node referencing a key slot
- * @param   arg Pointer to required key ID
- * @return  int
- *          1 if input ID equals node ID
- *          0 otherwise
- */
-static int node_id_equals_key_id(clist_node_t *n, void *arg)
+static psa_status_t lock_key_slot(psa_key_slot_t *slot)
 {
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    psa_key_id_t id = *((psa_key_id_t *)arg);
-
-    if (slot->attr.id == id) {
-        return 1;
+    if (slot->lock_count >= SIZE_MAX) {
+        return PSA_ERROR_CORRUPTION_DETECTED;
     }
 
-    return 0;
-}
-
-#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
-static int node_lifetime_is_persistent(clist_node_t *n, void *arg)
-{
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) {
-        return 1;
-    }
+    slot->lock_count++;
 
-    (void) arg;
-    return 0;
+    return PSA_SUCCESS;
 }
-#endif /* MODULE_PSA_PERSISTENT_STORAGE */
+
+static psa_status_t allocate_empty_key_slot(psa_key_id_t *id,
+                                            const psa_key_attributes_t *attr,
+                                            psa_key_slot_t **p_slot);
 
 /**
  * @brief   Find the key slot containing the key with a specified ID
@@ -280,19 +417,20 @@ static int node_lifetime_is_persistent(clist_node_t *n, void *arg)
  *          @ref PSA_ERROR_CORRUPTION_DETECTED
  *          @ref PSA_ERROR_NOT_SUPPORTED
  */
-static psa_status_t psa_get_and_lock_key_slot_in_memory(psa_key_id_t id, psa_key_slot_t **p_slot)
+static psa_status_t get_and_lock_key_slot_in_memory(psa_key_id_t id, psa_key_slot_t **p_slot)
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    key_index_entry_t *entry = key_index_find(id);
 
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_id_equals_key_id, &id);
-    if (slot_node == NULL) {
+    /* The slot only carries the ID once the creation of the key started */
+    if ((entry == NULL) || (entry->slot->attr.id != id)) {
         return PSA_ERROR_DOES_NOT_EXIST;
     }
 
-    psa_key_slot_t *slot = container_of(slot_node, psa_key_slot_t, node);
-    status = psa_lock_key_slot(slot);
+    status = lock_key_slot(entry->slot);
     if (status == PSA_SUCCESS) {
-        *p_slot = slot;
+        entry->last_use = ++key_use_count;
+        *p_slot = entry->slot;
     }
     return status;
 }
@@ -305,8 +443,8 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(psa_key_id_t id, psa_key
  * @param   p_slot    Pointer to store key slot in
  * @return  psa_status_t
  */
-static psa_status_t psa_get_persisted_key_slot_from_storage(psa_key_id_t id,
-                                                            psa_key_slot_t **p_slot)
+static psa_status_t get_persisted_key_slot_from_storage(psa_key_id_t id,
+                                                        psa_key_slot_t **p_slot)
 {
     uint8_t cbor_buf[CBOR_BUF_MAX_SIZE];
     size_t cbor_encoded_len;
@@ -325,7 +463,7 @@ static psa_status_t psa_get_persisted_key_slot_from_storage(psa_key_id_t id,
     }
 
     /* Allocate key slot for specific key type */
-    status = psa_allocate_empty_key_slot(&attr.id, &attr, p_slot);
+    status = allocate_empty_key_slot(&attr.id, &attr, p_slot);
     if (status != PSA_SUCCESS) {
         return status;
     }
@@ -354,20 +492,37 @@ psa_status_t psa_persist_key_slot_in_storage(psa_key_slot_t *slot)
 }
 
 /**
- * @brief   Find and wipe a persistent key slot in local storage to make room for a new key
+ * @brief   Find and wipe the least recently used persistent key slot in local storage to make
+ *          room for a new key
+ *
+ * @param   empty_list  List of empty slots the freed slot must go to
  *
  * @return  PSA_SUCCESS
- * @return  PSA_ERROR_INSUFFICIENT_STORAGE  No persistent key found in local storage
+ * @return  PSA_ERROR_INSUFFICIENT_STORAGE  No unused persistent key found in local storage
  *          PSA_ERROR_DOES_NOT_EXIST
  */
-static psa_status_t psa_find_and_wipe_persistent_key_from_local_storage(void)
+static psa_status_t find_and_wipe_persistent_key_from_local_storage(clist_node_t *empty_list)
 {
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_lifetime_is_persistent, NULL);
-    if (slot_node == NULL) {
+    key_index_entry_t *lru = NULL;
+
+    for (unsigned i = 0; i < KEY_INDEX_SIZE; i++) {
+        psa_key_slot_t *slot = key_index[i].slot;
+
+        if ((slot == NULL) || PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime) ||
+            psa_is_key_slot_locked(slot) ||
+            (psa_get_empty_key_slot_list(&slot->attr) != empty_list)) {
+            continue;
+        }
+        if ((lru == NULL) ||
+            ((key_use_count - key_index[i].last_use) > (key_use_count - lru->last_use))) {
+            lru = &key_index[i];
+        }
+    }
+    if (lru == NULL) {
         return PSA_ERROR_INSUFFICIENT_STORAGE;
     }
 
-    return psa_wipe_key_slot(container_of(slot_node, psa_key_slot_t, node));
+    return wipe_key_slot(lru->slot);
 }
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
@@ -378,14 +533,16 @@ psa_status_t psa_get_and_lock_key_slot(psa_key_id_t id, psa_key_slot_t **p_slot)
 
     *p_slot = NULL;
 
+    slot_mgmt_lock();
     /* Try to find key in volatile key slot list */
-    status = psa_get_and_lock_key_slot_in_memory(id, p_slot);
+    status = get_and_lock_key_slot_in_memory(id, p_slot);
 
 #if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
     if (status == PSA_ERROR_DOES_NOT_EXIST && !psa_key_id_is_volatile(id)) {
-        return psa_get_persisted_key_slot_from_storage(id, p_slot);
+        status = get_persisted_key_slot_from_storage(id, p_slot);
     }
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
+    slot_mgmt_unlock();
 
     return status;
 }
@@ -400,8 +557,8 @@ psa_status_t psa_get_and_lock_key_slot(psa_key_id_t id, psa_key_slot_t **p_slot)
  *          @ref PSA_ERROR_DOES_NOT_EXIST   No key slots for this type of key exist
  *          @ref PSA_ERROR_INSUFFICIENT_STORAGE
  */
-static psa_status_t psa_allocate_key_slot_in_list(psa_key_slot_t **p_slot,
-                                                  const psa_key_attributes_t *attr)
+static psa_status_t allocate_key_slot_in_list(psa_key_slot_t **p_slot,
+                                              const psa_key_attributes_t *attr)
 {
     clist_node_t *empty_list = psa_get_empty_key_slot_list(attr);
 
@@ -414,7 +571,7 @@ static psa_status_t psa_allocate_key_slot_in_list(psa_key_slot_t **p_slot,
 #if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
         /* If no slots left: Look for slot in list with persistent key
            (key will be stored in persistent memory and slot can be reused) */
-        psa_status_t status = psa_find_and_wipe_persistent_key_from_local_storage();
+        psa_status_t status = find_and_wipe_persistent_key_from_local_storage(empty_list);
         if (status != PSA_SUCCESS) {
             DEBUG("Key Slot MGMT: No PSA Key Slot available\n");
             return status;
@@ -436,9 +593,9 @@ static psa_status_t psa_allocate_key_slot_in_list(psa_key_slot_t **p_slot,
     return PSA_SUCCESS;
 }
 
-psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
-                                         const psa_key_attributes_t *attr,
-                                         psa_key_slot_t **p_slot)
+static psa_status_t allocate_empty_key_slot(psa_key_id_t *id,
+                                            const psa_key_attributes_t *attr,
+                                            psa_key_slot_t **p_slot)
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_slot_t *new_slot = NULL;
@@ -449,7 +606,7 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
         return PSA_ERROR_INSUFFICIENT_STORAGE;
     }
 
-    status = psa_allocate_key_slot_in_list(&new_slot, attr);
+    status = allocate_key_slot_in_list(&new_slot, attr);
     if (status != PSA_SUCCESS) {
         *p_slot = NULL;
         *id = 0;
@@ -457,7 +614,7 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
     }
 
     if (new_slot != NULL) {
-        status = psa_lock_key_slot(new_slot);
+        status = lock_key_slot(new_slot);
         if (status != PSA_SUCCESS) {
             *p_slot = NULL;
             *id = 0;
@@ -476,6 +633,7 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
             DEBUG("Key Slot MGMT: invalid lifetime or ID\n");
             return PSA_ERROR_INVALID_ARGUMENT;
         }
+        key_index_add(*id, new_slot);
         *p_slot = new_slot;
 
         return PSA_SUCCESS;
@@ -487,29 +645,42 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
     return status;
 }
 
-psa_status_t psa_lock_key_slot(psa_key_slot_t *slot)
+psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
+                                         const psa_key_attributes_t *attr,
+                                         psa_key_slot_t **p_slot)
 {
-    if (slot->lock_count >= SIZE_MAX) {
-        return PSA_ERROR_CORRUPTION_DETECTED;
-    }
+    slot_mgmt_lock();
+    psa_status_t status = allocate_empty_key_slot(id, attr, p_slot);
+    slot_mgmt_unlock();
 
-    slot->lock_count++;
+    return status;
+}
 
-    return PSA_SUCCESS;
+psa_status_t psa_lock_key_slot(psa_key_slot_t *slot)
+{
+    slot_mgmt_lock();
+    psa_status_t status = lock_key_slot(slot);
+    slot_mgmt_unlock();
+
+    return status;
 }
 
 psa_status_t psa_unlock_key_slot(psa_key_slot_t *slot)
 {
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
     if (slot == NULL) {
         return PSA_SUCCESS;
     }
 
+    slot_mgmt_lock();
     if (slot->lock_count > 0) {
         slot->lock_count--;
-        return PSA_SUCCESS;
+        status = PSA_SUCCESS;
     }
+    slot_mgmt_unlock();
 
-    return PSA_ERROR_CORRUPTION_DETECTED;
+    return status;
 }
 
 psa_status_t psa_validate_key_location(psa_key_lifetime_t lifetime, psa_se_drv_data_t **p_drv)
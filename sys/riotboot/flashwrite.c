@@ -64,6 +64,9 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
 
     state->offset = offset;
     state->target_slot = target_slot;
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    sha256_init(&state->sha256);
+#endif
     state->flashpage =
         flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
 
@@ -139,6 +142,9 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
 
         memcpy(state->flashpage_buf + flashwrite_buffer_pos, bytes, to_copy);
         flashpage_avail -= to_copy;
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+        sha256_update(&state->sha256, bytes, to_copy);
+#endif
 
         state->offset += to_copy;
         bytes += to_copy;
@@ -154,7 +160,9 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
             else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
+                /* the chunk may have started within the write block */
+                flashpage_write((uint8_t *)addr + flashpage_pos -
+                                flashwrite_buffer_pos,
                                 state->flashpage_buf,
                                 RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
@@ -26,6 +26,7 @@
 #include "architecture.h"
 #include "hashes/sha256.h"
 #include "log.h"
+#include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
@@ -58,3 +59,29 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
 
     return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
 }
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+int riotboot_flashwrite_verify_sha256_state(const riotboot_flashwrite_t *state,
+                                            const uint8_t *sha256_digest,
+                                            size_t img_len)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    /* finalize a copy, the update may still continue */
+    sha256_context_t sha256 = state->sha256;
+
+    if (img_len < 4) {
+        LOG_INFO("riotboot: verify_sha256(): image too small\n");
+        return -1;
+    }
+
+    if (state->offset != img_len) {
+        LOG_INFO("riotboot: verify_sha256(): %" PRIuSIZE " of %" PRIuSIZE
+                 " bytes written\n", state->offset, img_len);
+        return 1;
+    }
+
+    sha256_final(&sha256, digest);
+
+    return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
+}
+#endif
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sched_latency
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency histogram implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "bitfield.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_latency.h"
+#include "thread.h"
+#include "ztimer.h"
+
+static_assert((CONFIG_SCHED_LATENCY_BUCKETS > 1) &&
+              (CONFIG_SCHED_LATENCY_BUCKETS <= 33),
+              "CONFIG_SCHED_LATENCY_BUCKETS must be in [2, 33]");
+
+static sched_latency_stats_t _stats[SCHED_PRIO_LEVELS];
+static uint32_t _woken_at[KERNEL_PID_LAST + 1];
+static BITFIELD(_woken, KERNEL_PID_LAST + 1);
+static bool _enabled;
+
+static unsigned _bucket(uint32_t latency)
+{
+    if (latency == 0) {
+        return 0;
+    }
+
+    unsigned bucket = bitarithm_msb(latency) + 1;
+
+    return (bucket < CONFIG_SCHED_LATENCY_BUCKETS)
+           ? bucket : (CONFIG_SCHED_LATENCY_BUCKETS - 1);
+}
+
+void sched_latency_wakeup_cb(const thread_t *thread)
+{
+    if (!_enabled) {
+        return;
+    }
+    _woken_at[thread->pid] = ztimer_now(ZTIMER_USEC);
+    bf_set(_woken, thread->pid);
+}
+
+void sched_latency_run_cb(const thread_t *thread)
+{
+    if (!bf_isset(_woken, thread->pid)) {
+        return;
+    }
+    bf_unset(_woken, thread->pid);
+
+    sched_latency_stats_t *stats = &_stats[thread->priority];
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - _woken_at[thread->pid];
+
+    stats->hist[_bucket(latency)]++;
+    stats->wakeups++;
+    if (latency > stats->max_us) {
+        stats->max_us = latency;
+    }
+}
+
+void sched_latency_preempt_cb(const thread_t *thread)
+{
+    if (_enabled) {
+        _stats[thread->priority].preemptions++;
+    }
+}
+
+void sched_latency_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(_stats, 0, sizeof(_stats));
+    irq_restore(state);
+}
+
+void sched_latency_init(void)
+{
+    /* timestamps are taken from scheduler context, keep the clock running */
+    ztimer_acquire(ZTIMER_USEC);
+
+    unsigned state = irq_disable();
+
+    memset(_woken, 0, sizeof(_woken));
+    memset(_stats, 0, sizeof(_stats));
+    _enabled = true;
+    irq_restore(state);
+}
+
+void sched_latency_get(uint8_t prio, sched_latency_stats_t *stats)
+{
+    assert(prio < SCHED_PRIO_LEVELS);
+
+    unsigned state = irq_disable();
+
+    *stats = _stats[prio];
+    irq_restore(state);
+}
+
+void sched_latency_print(void)
+{
+    printf("\tpri | wakeups    | max_us     | preempt    | latency histogram"
+           " (<1, <2, <4, ... µs)\n");
+    for (uint8_t prio = 0; prio < SCHED_PRIO_LEVELS; prio++) {
+        sched_latency_stats_t stats;
+
+        sched_latency_get(prio, &stats);
+        if ((stats.wakeups == 0) && (stats.preemptions == 0)) {
+            continue;
+        }
+        printf("\t%3u | %10" PRIu32 " | %10" PRIu32 " | %10" PRIu32 " |",
+               (unsigned)prio, stats.wakeups, stats.max_us, stats.preemptions);
+        for (unsigned i = 0; i < CONFIG_SCHED_LATENCY_BUCKETS; i++) {
+            printf(" %" PRIu32, stats.hist[i]);
+        }
+        puts("");
+    }
+}
@@ -73,6 +73,9 @@ static void _vfs_usage(char **argv)
 #endif
            " <path>\n", argv[0]);
     printf("%s df [path]\n", argv[0]);
+    if (IS_USED(MODULE_VFS_READAHEAD)) {
+        printf("%s ra\n", argv[0]);
+    }
     if (MOUNTPOINTS_NUMOF > 0) {
         printf("%s mount [path]\n", argv[0]);
     }
@@ -93,6 +96,9 @@ static void _vfs_usage(char **argv)
     puts("cp: Copy <src> file to <dest>");
     puts("rm: Unlink (delete) a file or a directory at <path>");
     puts("df: Show file system space utilization stats");
+    if (IS_USED(MODULE_VFS_READAHEAD)) {
+        puts("ra: Show read-ahead hit rates");
+    }
 }
 
 static void _print_size(uint64_t size)
@@ -168,6 +174,39 @@ static int _df_handler(int argc, char **argv)
     return 0;
 }
 
+static void _print_ra(const char *name, const vfs_readahead_stats_t *stats)
+{
+    uint32_t total = stats->hits + stats->misses;
+
+    printf("%-8s %10" PRIu32 " %10" PRIu32 " %5" PRIu32 "%%\n", name,
+           stats->hits, stats->misses,
+           total ? (uint32_t)(((uint64_t)stats->hits * 100) / total) : 0);
+}
+
+static int _ra_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    vfs_readahead_stats_t stats;
+
+    puts("fd             hits     misses  rate");
+    for (int fd = 0; fd < VFS_MAX_OPEN_FILES; fd++) {
+        char name[8];
+
+        if ((vfs_readahead_stats(fd, &stats) < 0) ||
+            (stats.hits + stats.misses == 0)) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%d", fd);
+        _print_ra(name, &stats);
+    }
+    vfs_readahead_stats(VFS_ANY_FD, &stats);
+    _print_ra("total", &stats);
+
+    return 0;
+}
+
 static int _mount_handler(int argc, char **argv)
 {
     if (argc < 2) {
@@ -704,6 +743,9 @@ static int _vfs_handler(int argc, char **argv)
     else if (strcmp(argv[1], "df") == 0) {
         return _df_handler(argc - 1, &argv[1]);
     }
+    else if (IS_USED(MODULE_VFS_READAHEAD) && strcmp(argv[1], "ra") == 0) {
+        return _ra_handler(argc - 1, &argv[1]);
+    }
     else if (MOUNTPOINTS_NUMOF > 0 && strcmp(argv[1], "mount") == 0) {
         return _mount_handler(argc - 1, &argv[1]);
     }
@@ -24,6 +24,7 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "atomic_utils.h"
+#include "bitfield.h"
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
@@ -66,6 +67,16 @@ XFA_INIT(vfs_mount_t, vfs_mountpoints_xfa);
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Allocation bitmap of the _vfs_open_files array
+ *
+ * Used to find a free fd without scanning _vfs_open_files. The bits of
+ * STDIN, STDOUT and STDERR (the three most significant bits of the first byte)
+ * are always set, so these are never handed out for @ref VFS_ANY_FD.
+ */
+static BITFIELD(_vfs_fd_used, VFS_MAX_OPEN_FILES) = { 0xe0 };
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -75,6 +86,20 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+#if CONFIG_VFS_MOUNT_INDEX_SIZE
+/**
+ * @internal
+ * @brief Mounted file systems ordered by descending mount point length
+ *
+ * The first entry that is a prefix of a path is the longest match, so
+ * _find_mount() can stop there. Rebuilt on every mount and umount, only used
+ * if all mounts fit in.
+ */
+static vfs_mount_t *_mount_index[CONFIG_VFS_MOUNT_INDEX_SIZE];
+static uint8_t _mount_index_numof;
+static bool _mount_index_valid;
+#endif
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -83,9 +108,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, an unused slot is taken from the
+ * allocation bitmap and its number is returned.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -134,6 +158,14 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
  */
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path);
 
+/**
+ * @internal
+ * @brief Rebuild the mount point index after the list of mounts changed
+ *
+ * Must be called with _mount_mutex held.
+ */
+static void _mount_index_rebuild(void);
+
 /**
  * @internal
  * @brief Check that a given fd number is valid
@@ -148,6 +180,91 @@ static inline int _fd_is_valid(int fd);
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
+#if IS_USED(MODULE_VFS_READAHEAD)
+/**
+ * @internal
+ * @brief Read-ahead statistics of all files since boot
+ */
+static vfs_readahead_stats_t _ra_stats;
+
+static inline size_t _ra_size(const vfs_file_t *filp)
+{
+    if ((filp->mp == NULL) || ((filp->flags & O_ACCMODE) != O_RDONLY)) {
+        return 0;
+    }
+    return MIN(filp->mp->readahead, CONFIG_VFS_READAHEAD_SIZE);
+}
+
+static inline size_t _ra_pending(const vfs_file_t *filp)
+{
+    return filp->ra.len - filp->ra.pos;
+}
+
+static void _ra_count(vfs_file_t *filp, bool hit)
+{
+    if (hit) {
+        filp->ra.stats.hits++;
+        _ra_stats.hits++;
+    }
+    else {
+        filp->ra.stats.misses++;
+        _ra_stats.misses++;
+    }
+}
+
+static ssize_t _ra_read(vfs_file_t *filp, uint8_t *dest, size_t count,
+                        size_t ra_size)
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    size_t pending = _ra_pending(filp);
+    size_t n = MIN(count, pending);
+
+    memcpy(dest, &filp->ra.buf[filp->ra.pos], n);
+    filp->ra.pos += n;
+    if (n == count) {
+        _ra_count(filp, true);
+        return n;
+    }
+    _ra_count(filp, false);
+
+    dest += n;
+    count -= n;
+
+    if (count >= ra_size) {
+        /* large read, bypass the buffer */
+        ssize_t res = filp->f_op->read(filp, dest, count);
+        if (res < 0) {
+            return (n > 0) ? (ssize_t)n : res;
+        }
+        return n + res;
+    }
+
+    ssize_t res = filp->f_op->read(filp, filp->ra.buf, ra_size);
+    if (res < 0) {
+        return (n > 0) ? (ssize_t)n : res;
+    }
+    filp->ra.len = res;
+    filp->ra.pos = MIN(count, (size_t)res);
+    memcpy(dest, filp->ra.buf, filp->ra.pos);
+
+    return n + filp->ra.pos;
+}
+#endif
+
+static ssize_t _read(vfs_file_t *filp, void *dest, size_t count)
+{
+#if IS_USED(MODULE_VFS_READAHEAD)
+    size_t ra_size = _ra_size(filp);
+    if (ra_size > 0) {
+        return _ra_read(filp, dest, count, ra_size);
+    }
+#endif
+    return filp->f_op->read(filp, dest, count);
+}
+
 int vfs_close(int fd)
 {
     DEBUG("vfs_close: %d\n", fd);
@@ -242,14 +359,8 @@ int vfs_dstatvfs(vfs_DIR *dirp, struct statvfs *buf)
     return dirp->mp->fs->fs_op->statvfs(dirp->mp, "/", buf);
 }
 
-off_t vfs_lseek(int fd, off_t off, int whence)
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
 {
-    DEBUG("vfs_lseek: %d, %ld, %d\n", fd, (long)off, whence);
-    int res = _fd_is_valid(fd);
-    if (res < 0) {
-        return res;
-    }
-    vfs_file_t *filp = &_vfs_open_files[fd];
     if (filp->f_op->lseek == NULL) {
         /* driver does not implement lseek() */
         /* default seek functionality is naive */
@@ -277,6 +388,30 @@ off_t vfs_lseek(int fd, off_t off, int whence)
     return filp->f_op->lseek(filp, off, whence);
 }
 
+off_t vfs_lseek(int fd, off_t off, int whence)
+{
+    DEBUG("vfs_lseek: %d, %ld, %d\n", fd, (long)off, whence);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+#if IS_USED(MODULE_VFS_READAHEAD)
+    if (whence == SEEK_CUR) {
+        /* the driver is ahead of the reader by the buffered bytes */
+        off -= _ra_pending(filp);
+    }
+    off = _lseek(filp, off, whence);
+    if (off >= 0) {
+        filp->ra.pos = 0;
+        filp->ra.len = 0;
+    }
+    return off;
+#else
+    return _lseek(filp, off, whence);
+#endif
+}
+
 int vfs_open(const char *name, int flags, mode_t mode)
 {
     DEBUG("vfs_open: \"%s\", 0x%x, 0%03lo\n", name, flags, (long unsigned int)mode);
@@ -353,7 +488,38 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         return res;
     }
 
-    return filp->f_op->read(filp, dest, count);
+    return _read(filp, dest, count);
+}
+
+ssize_t vfs_read_iol(int fd, const iolist_t *iolist)
+{
+    DEBUG("vfs_read_iol: %d, %p\n", fd, (void *)iolist);
+    vfs_file_t *filp = NULL;
+    ssize_t sum = 0;
+
+    for (; iolist; iolist = iolist->iol_next) {
+        if (iolist->iol_len == 0) {
+            continue;
+        }
+
+        int res = _prep_read(fd, iolist->iol_base, &filp);
+        if (res) {
+            DEBUG("vfs_read_iol: can't open file - %d\n", res);
+            return res;
+        }
+
+        ssize_t len = _read(filp, iolist->iol_base, iolist->iol_len);
+        if (len < 0) {
+            return (sum > 0) ? sum : len;
+        }
+        sum += len;
+        if ((size_t)len < iolist->iol_len) {
+            /* end of file */
+            break;
+        }
+    }
+
+    return sum;
 }
 
 ssize_t vfs_readline(int fd, char *dst, size_t len_max)
@@ -369,7 +535,7 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
 
     const char *start = dst;
     while (len_max) {
-        int res = filp->f_op->read(filp, dst, 1);
+        int res = _read(filp, dst, 1);
         if (res < 0) {
             break;
         }
@@ -600,6 +766,7 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _mount_index_rebuild();
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -646,6 +813,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    _mount_index_rebuild();
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -1075,23 +1243,47 @@ const vfs_file_t *vfs_file_get(int fd)
     }
 }
 
+int vfs_readahead_stats(int fd, vfs_readahead_stats_t *stats)
+{
+#if IS_USED(MODULE_VFS_READAHEAD)
+    if (fd == VFS_ANY_FD) {
+        *stats = _ra_stats;
+        return 0;
+    }
+
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    *stats = _vfs_open_files[fd].ra.stats;
+    return 0;
+#else
+    (void)fd;
+    (void)stats;
+    return -ENOTSUP;
+#endif
+}
+
+static inline bool _fd_is_stdio(int fd)
+{
+    return (fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO);
+}
+
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
-                /* Do not auto-allocate the stdio file descriptor numbers to
-                 * avoid conflicts between normal file system users and stdio
-                 * drivers such as stdio_uart, stdio_rtt which need to be able
-                 * to bind to these specific file descriptor numbers. */
-                continue;
-            }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
-                break;
-            }
+        /* Do not auto-allocate the stdio file descriptor numbers to
+         * avoid conflicts between normal file system users and stdio
+         * drivers such as stdio_uart, stdio_rtt which need to be able
+         * to bind to these specific file descriptor numbers. Their bits
+         * are always set in _vfs_fd_used. */
+        fd = bf_get_unset(_vfs_fd_used, VFS_MAX_OPEN_FILES);
+        if (fd < 0) {
+            /* The _vfs_open_files array is full */
+            return -ENFILE;
         }
     }
-    if (fd >= VFS_MAX_OPEN_FILES) {
+    else if (fd >= VFS_MAX_OPEN_FILES) {
         /* The _vfs_open_files array is full */
         return -ENFILE;
     }
@@ -1099,6 +1291,9 @@ static inline int _allocate_fd(int fd)
         /* The desired fd is already in use */
         return -EEXIST;
     }
+    else if (!_fd_is_stdio(fd)) {
+        bf_set_atomic(_vfs_fd_used, fd);
+    }
     kernel_pid_t pid = thread_getpid();
     if (pid == KERNEL_PID_UNDEF) {
         /* This happens when calling vfs_bind during boot, before threads have
@@ -1117,6 +1312,9 @@ static inline void _free_fd(int fd)
         assume(before > 0);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    if (!_fd_is_stdio(fd)) {
+        bf_unset_atomic(_vfs_fd_used, fd);
+    }
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1131,47 +1329,103 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     filp->flags = flags;
     filp->pos = 0;
     filp->private_data.ptr = private_data;
+#if IS_USED(MODULE_VFS_READAHEAD)
+    memset(&filp->ra.stats, 0, sizeof(filp->ra.stats));
+    filp->ra.pos = 0;
+    filp->ra.len = 0;
+#endif
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+static inline bool _mount_matches(const vfs_mount_t *it, const char *name,
+                                  size_t name_len)
 {
-    size_t longest_match = 0;
-    size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
+    size_t len = it->mount_point_len;
+    if (len > name_len) {
+        /* path name is shorter than the mount point name */
+        return false;
+    }
+    if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
+        /* name does not have a directory separator where mount point name ends */
+        return false;
+    }
+    /* mount_point is a prefix of name */
+    return strncmp(name, it->mount_point, len) == 0;
+}
 
+static void _mount_index_rebuild(void)
+{
+#if CONFIG_VFS_MOUNT_INDEX_SIZE
+    unsigned numof = 0;
+
+    _mount_index_valid = false;
     clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+    if (node != NULL) {
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            if (numof == CONFIG_VFS_MOUNT_INDEX_SIZE) {
+                /* too many mounts, _find_mount() falls back to the list */
+                return;
+            }
+            /* insertion sort, of mounts with the same length the one mounted
+             * last comes first (and wins) like in the list walk */
+            unsigned i = numof++;
+            while ((i > 0) &&
+                   (_mount_index[i - 1]->mount_point_len <= it->mount_point_len)) {
+                _mount_index[i] = _mount_index[i - 1];
+                --i;
+            }
+            _mount_index[i] = it;
+        } while (node != _vfs_mounts_list.next);
     }
+    _mount_index_numof = numof;
+    _mount_index_valid = true;
+#endif
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t name_len = strlen(name);
     vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
+    mutex_lock(&_mount_mutex);
+
+#if CONFIG_VFS_MOUNT_INDEX_SIZE
+    if (_mount_index_valid) {
+        for (unsigned i = 0; i < _mount_index_numof; i++) {
+            if (_mount_matches(_mount_index[i], name, name_len)) {
+                mountp = _mount_index[i];
+                break;
+            }
         }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
+    }
+    else
+#endif
+    {
+        size_t longest_match = 0;
+        clist_node_t *node = _vfs_mounts_list.next;
+        if (node == NULL) {
+            /* list empty */
+            mutex_unlock(&_mount_mutex);
+            return -ENOENT;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
-            /* special check for mount_point == "/" */
-            if (len > 1) {
-                longest_match = len;
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            size_t len = it->mount_point_len;
+            if (len < longest_match) {
+                /* Already found a longer prefix */
+                continue;
             }
-            mountp = it;
-        }
-    } while (node != _vfs_mounts_list.next);
+            if (_mount_matches(it, name, name_len)) {
+                /* special check for mount_point == "/" */
+                if (len > 1) {
+                    longest_match = len;
+                }
+                mountp = it;
+            }
+        } while (node != _vfs_mounts_list.next);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
@@ -1191,7 +1445,9 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
         if (mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) {
             *rel_path = name;
         } else {
-            *rel_path = name + longest_match;
+            /* special case for mount_point == "/" */
+            size_t len = mountp->mount_point_len;
+            *rel_path = (len > 1) ? (name + len) : name;
         }
     }
     return 0;
@@ -43,6 +43,24 @@ static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
+#if MODULE_ZTIMER_HEAP
+static void _heap_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _heap_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _heap_update_epoch(ztimer_clock_t *clock);
+static ztimer_t *_heap_now_next(ztimer_clock_t *clock);
+
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+    return clock->heap;
+}
+#else
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+    (void)clock;
+    return false;
+}
+#endif
+
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
@@ -117,11 +135,30 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
     if (!clock->list.next) {
         return 0;
     }
+#if MODULE_ZTIMER_HEAP
+    else if (_uses_heap(clock)) {
+        return t->base.prev != NULL;
+    }
+#endif
     else {
         return (t->base.next || &t->base == clock->last);
     }
 }
 
+/* returns the number of ticks from the clock's base time to the first timer */
+static uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        uint32_t head = clock->list.next->offset - clock->heap_epoch;
+        uint32_t base = clock->list.offset - clock->heap_epoch;
+
+        return (head > base) ? head - base : 0;
+    }
+#endif
+    return clock->list.next->offset;
+}
+
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
 {
     unsigned state = irq_disable();
@@ -227,6 +264,13 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        _heap_add(clock, entry);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -289,7 +333,8 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
-    ztimer_base_t *entry = clock->list.next;
+    /* the heap stores absolute targets, nothing to update per entry */
+    ztimer_base_t *entry = _uses_heap(clock) ? NULL : clock->list.next;
 
     DEBUG(
         "clock %p: _ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
@@ -323,18 +368,20 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     }
 
     clock->list.offset = now;
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        _heap_update_epoch(clock);
+    }
+#endif
     return now;
 }
 
-static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+static bool _del_entry_from_linked_list(ztimer_clock_t *clock,
+                                        ztimer_base_t *entry)
 {
     bool was_removed = false;
-
-    DEBUG("_del_entry_from_list()\n");
     ztimer_base_t *list = &clock->list;
 
-    assert(_is_set(clock, (ztimer_t *)entry));
-
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -358,6 +405,28 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         list = list->next;
     }
 
+    return was_removed;
+}
+
+static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    bool was_removed;
+
+    DEBUG("_del_entry_from_list()\n");
+
+    assert(_is_set(clock, (ztimer_t *)entry));
+
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        _heap_del(clock, entry);
+        was_removed = true;
+    }
+    else
+#endif
+    {
+        was_removed = _del_entry_from_linked_list(clock, entry);
+    }
+
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* The last timer just got removed from the clock's linked list */
     if (clock->list.next == NULL &&
@@ -371,6 +440,12 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        return _heap_now_next(clock);
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -395,13 +470,247 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_HEAP
+/*
+ * Pairing heap timer queue
+ *
+ * Each entry stores its absolute target time in `offset`. `next` links
+ * siblings, `child` points to the first child and `prev` points to the parent
+ * (for a first child) or to the left sibling. The root is `clock->list.next`
+ * and its `prev` points to `clock->list`, so `prev` is non-NULL for every
+ * set timer.
+ *
+ * Targets are compared relative to `clock->heap_epoch`, which is kept at the
+ * clock's base time (`clock->list.offset`) or, if the first timer is already
+ * overdue, at that timer's target. This way, all targets are within 2^32
+ * ticks after the epoch and can be compared using unsigned arithmetic.
+ */
+static inline uint32_t _heap_key(const ztimer_clock_t *clock,
+                                 const ztimer_base_t *entry)
+{
+    return entry->offset - clock->heap_epoch;
+}
+
+static void _heap_set_root(ztimer_clock_t *clock, ztimer_base_t *root)
+{
+    clock->list.next = root;
+    if (root) {
+        root->prev = &clock->list;
+        root->next = NULL;
+    }
+}
+
+static ztimer_base_t *_heap_meld(const ztimer_clock_t *clock,
+                                 ztimer_base_t *a, ztimer_base_t *b)
+{
+    /* on equal targets, keep the current root (a) in front */
+    if (_heap_key(clock, b) < _heap_key(clock, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+static ztimer_base_t *_heap_merge_pairs(const ztimer_clock_t *clock,
+                                        ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+
+    /* meld siblings pairwise from left to right, collecting the results in
+     * reverse order */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        if (b) {
+            first = b->next;
+            a = _heap_meld(clock, a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* meld the results from right to left */
+    ztimer_base_t *root = pairs;
+
+    if (root) {
+        pairs = root->next;
+        while (pairs) {
+            ztimer_base_t *next = pairs->next;
+            root = _heap_meld(clock, root, pairs);
+            pairs = next;
+        }
+    }
+
+    return root;
+}
+
+static void _heap_update_epoch(ztimer_clock_t *clock)
+{
+    ztimer_base_t *head = clock->list.next;
+
+    if (head && (_heap_key(clock, head) <
+                 (uint32_t)(clock->list.offset - clock->heap_epoch))) {
+        clock->heap_epoch = head->offset;
+    }
+    else {
+        clock->heap_epoch = clock->list.offset;
+    }
+}
+
+/* Move all overdue timers to the clock's base time so that the epoch can be
+ * advanced to it. Only needed if a new target would otherwise be more than
+ * 2^32 ticks after the target of an overdue timer. */
+static void _heap_rebase(ztimer_clock_t *clock)
+{
+    uint32_t base = clock->list.offset - clock->heap_epoch;
+    ztimer_base_t *overdue = NULL;
+    ztimer_base_t *head;
+
+    while ((head = clock->list.next) && (_heap_key(clock, head) < base)) {
+        _heap_set_root(clock, _heap_merge_pairs(clock, head->child));
+        head->next = overdue;
+        overdue = head;
+    }
+
+    clock->heap_epoch = clock->list.offset;
+
+    while (overdue) {
+        ztimer_base_t *next = overdue->next;
+
+        overdue->offset = clock->list.offset;
+        overdue->child = NULL;
+        head = clock->list.next;
+        _heap_set_root(clock, head ? _heap_meld(clock, head, overdue) : overdue);
+        overdue = next;
+    }
+}
+
+static void _heap_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    /* entry->offset is relative to the clock's base time here */
+    uint32_t val = entry->offset;
+
+    if (val > UINT32_MAX - (clock->list.offset - clock->heap_epoch)) {
+        _heap_rebase(clock);
+    }
+
+    entry->offset = clock->list.offset + val;
+    entry->child = NULL;
+
+    ztimer_base_t *head = clock->list.next;
+    _heap_set_root(clock, head ? _heap_meld(clock, head, entry) : entry);
+
+    DEBUG("_heap_add() %p target %" PRIu32 "\n", (void *)entry, entry->offset);
+}
+
+static void _heap_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *sub = _heap_merge_pairs(clock, entry->child);
+
+    if (entry == clock->list.next) {
+        _heap_set_root(clock, sub);
+    }
+    else {
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        if (sub) {
+            _heap_set_root(clock, _heap_meld(clock, clock->list.next, sub));
+        }
+    }
+
+    /* reset the entry's prev pointer so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->child = NULL;
+    entry->prev = NULL;
+}
+
+static ztimer_t *_heap_now_next(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->list.next;
+
+    if (entry && (_heap_key(clock, entry) <=
+                  (uint32_t)(clock->list.offset - clock->heap_epoch))) {
+        _heap_set_root(clock, _heap_merge_pairs(clock, entry->child));
+        entry->next = NULL;
+        entry->child = NULL;
+        entry->prev = NULL;
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        /* The last timer just got removed from the clock's heap */
+        if (!clock->list.next &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+
+    return NULL;
+}
+
+void ztimer_heap_enable(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+
+    if (_uses_heap(clock)) {
+        irq_restore(state);
+        return;
+    }
+
+    /* detach the list, then move its timers over one by one */
+    _ztimer_update_head_offset(clock);
+    ztimer_base_t *entry = clock->list.next;
+    uint32_t offset = 0;
+
+    clock->list.next = NULL;
+    clock->last = NULL;
+    clock->heap = true;
+    clock->heap_epoch = clock->list.offset;
+
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+
+        offset += entry->offset;
+        entry->offset = offset;
+        entry->next = NULL;
+        _heap_add(clock, entry);
+        entry = next;
+    }
+
+    if (clock->list.next) {
+        _ztimer_update(clock);
+    }
+
+    irq_restore(state);
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -413,7 +722,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -437,7 +746,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -462,8 +771,10 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+        clock->list.offset += _head_offset(clock);
+        if (!_uses_heap(clock)) {
+            clock->list.next->offset = 0;
+        }
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
@@ -506,6 +817,15 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        printf("base %" PRIu32 " epoch %" PRIu32 " head 0x%08" PRIxPTR
+               ":%" PRIu32 "\n", clock->list.offset, clock->heap_epoch,
+               (uintptr_t)entry->next, entry->next ? entry->next->offset : 0);
+        return;
+    }
+#endif
+
     do {
         printf("0x%08" PRIxPTR ":%" PRIu32 "(%" PRIu32 ")%s", (uintptr_t)entry,
                entry->offset, entry->offset +
@@ -446,4 +446,25 @@ void ztimer_init(void)
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
 #endif
+
+#if MODULE_ZTIMER_HEAP
+#  if MODULE_ZTIMER_USEC
+    if (CONFIG_ZTIMER_USEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_USEC using timer heap\n");
+        ztimer_heap_enable(ZTIMER_USEC);
+    }
+#  endif
+#  if MODULE_ZTIMER_MSEC
+    if (CONFIG_ZTIMER_MSEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using timer heap\n");
+        ztimer_heap_enable(ZTIMER_MSEC);
+    }
+#  endif
+#  if MODULE_ZTIMER_SEC
+    if (CONFIG_ZTIMER_SEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_SEC using timer heap\n");
+        ztimer_heap_enable(ZTIMER_SEC);
+    }
+#  endif
+#endif
 }
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUTES
+#define NUMOF_ROUTES    (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE           (6)
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+    } };
+
+static const unsigned _numofs[] = { 16, 64, 256 };
+
+static ipv6_addr_t _route(unsigned i, unsigned *len)
+{
+    /* 2001:db8:<i>::/32..64, every fourth route covers the next three */
+    ipv6_addr_t pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } };
+
+    pfx.u16[2] = byteorder_htons(i & ~0x3);
+    pfx.u16[3] = byteorder_htons(i * 7);
+    *len = (i & 0x3) ? 64 : 48;
+    return pfx;
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t start, diff;
+    unsigned len;
+
+    for (unsigned i = 0; i < numof; i++) {
+        ipv6_addr_t pfx = _route(i, &len);
+
+        expect(gnrc_ipv6_nib_ft_add(&pfx, len, &_next_hop, IFACE, 0) == 0);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < REPEAT; i++) {
+        gnrc_ipv6_nib_ft_t fte;
+        ipv6_addr_t dst = _route(i % numof, &len);
+
+        dst.u8[15] = i;
+        expect(gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%3u routes: %" PRIu32 " us / %u lookups = %" PRIu32 " ns/lookup"
+           " (%" PRIu32 " lookups/s)\n", numof, diff, REPEAT,
+           (uint32_t)(((uint64_t)diff * 1000) / REPEAT),
+           (diff) ? (uint32_t)(((uint64_t)REPEAT * 1000000) / diff) : 0);
+
+    for (unsigned i = 0; i < numof; i++) {
+        ipv6_addr_t pfx = _route(i, &len);
+
+        gnrc_ipv6_nib_ft_del(&pfx, len);
+    }
+}
+
+int main(void)
+{
+    puts("NIB forwarding table lookup benchmark.");
+    for (unsigned i = 0; i < ARRAY_SIZE(_numofs); i++) {
+        if (_numofs[i] <= NUMOF_ROUTES) {
+            _bench(_numofs[i]);
+        }
+    }
+    puts("done.");
+    return 0;
+}
@@ -29,7 +29,13 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef TEST_BATCH_SIZE
+#define TEST_BATCH_SIZE     (8U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _batch_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _batch_queue[TEST_BATCH_SIZE];
 
 static void _timer_callback(void *_flag)
 {
@@ -49,18 +55,21 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
-int main(void)
+static void *_batch_thread(void *arg)
 {
-    puts("main starting");
+    (void)arg;
+    msg_t test[TEST_BATCH_SIZE];
 
-    kernel_pid_t other = thread_create(_stack,
-                                       sizeof(_stack),
-                                       (THREAD_PRIORITY_MAIN - 1),
-                                       0,
-                                       _second_thread,
-                                       NULL,
-                                       "second_thread");
+    msg_init_queue(_batch_queue, TEST_BATCH_SIZE);
+    while (1) {
+        msg_receive_many(test, TEST_BATCH_SIZE);
+    }
+
+    return NULL;
+}
 
+static uint32_t _run(kernel_pid_t other, unsigned batch)
+{
     atomic_flag flag = ATOMIC_FLAG_INIT;
     uint32_t n = 0;
 
@@ -72,16 +81,59 @@ int main(void)
     atomic_flag_test_and_set(&flag);
     xtimer_set(&timer, TEST_DURATION_US);
 
-    while (atomic_flag_test_and_set(&flag)) {
-        msg_t test;
-        msg_send(&test, other);
-        n++;
+    if (batch == 1) {
+        while (atomic_flag_test_and_set(&flag)) {
+            msg_t test;
+            msg_send(&test, other);
+            n++;
+        }
+    }
+    else {
+        while (atomic_flag_test_and_set(&flag)) {
+            msg_t test[TEST_BATCH_SIZE];
+            n += msg_send_many(test, batch, other);
+        }
     }
 
+    return n;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       0,
+                                       _second_thread,
+                                       NULL,
+                                       "second_thread");
+
+    uint32_t n = _run(other, 1);
+
     printf("{ \"result\" : %"PRIu32, n);
     printf(", \"ticks\" : %"PRIu32,
            (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
     puts(" }");
 
+    /* a queue of the batch size lets msg_send_many() deliver a whole batch
+     * with a single context switch */
+    other = thread_create(_batch_stack,
+                          sizeof(_batch_stack),
+                          (THREAD_PRIORITY_MAIN - 1),
+                          0,
+                          _batch_thread,
+                          NULL,
+                          "batch_thread");
+
+    n = _run(other, TEST_BATCH_SIZE);
+
+    printf("{ \"batch\" : %u", TEST_BATCH_SIZE);
+    printf(", \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+
     return 0;
 }
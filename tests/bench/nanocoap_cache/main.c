@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Latency benchmark for nanocoap_cache lookups
+ *
+ * The cache is filled with responses to @ref REQUESTS_NUMOF different
+ * requests. Then the cache key derivation alone, lookups that hit and
+ * lookups that miss are each repeated for about @ref MEASURE_US.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/nanocoap/cache.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define REQUESTS_NUMOF  CONFIG_NANOCOAP_CACHE_ENTRIES
+
+#ifndef MEASURE_US
+#define MEASURE_US      (200U * US_PER_MS)
+#endif
+
+#define BUF_SIZE        (128U)
+
+typedef struct {
+    coap_pkt_t pkt;
+    uint8_t buf[BUF_SIZE];
+} _msg_t;
+
+/* the last one is never added to the cache */
+static _msg_t _reqs[REQUESTS_NUMOF + 1];
+static _msg_t _resp;
+static volatile uintptr_t _sink;
+
+static void _build_req(_msg_t *req, unsigned n)
+{
+    char path[32];
+    char query[16];
+    uint16_t id = n;
+
+    ssize_t len = coap_build_udp_hdr(req->buf, sizeof(req->buf), COAP_TYPE_CON,
+                                     &id, sizeof(id), COAP_METHOD_GET, id);
+    expect(len > 0);
+    coap_pkt_init(&req->pkt, req->buf, sizeof(req->buf), len);
+    coap_opt_add_string(&req->pkt, COAP_OPT_URI_HOST, "sensors.example.org", '/');
+    snprintf(path, sizeof(path), "/building/floor/room%u/temp", n);
+    coap_opt_add_uri_path(&req->pkt, path);
+    snprintf(query, sizeof(query), "%u", n % 2 ? 1 : 2);
+    coap_opt_add_uri_query(&req->pkt, "unit", query);
+    coap_opt_finish(&req->pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void _build_resp(_msg_t *resp)
+{
+    uint16_t id = 0;
+    ssize_t len = coap_build_udp_hdr(resp->buf, sizeof(resp->buf),
+                                     COAP_TYPE_ACK, &id, sizeof(id),
+                                     COAP_CODE_CONTENT, id);
+    expect(len > 0);
+    coap_pkt_init(&resp->pkt, resp->buf, sizeof(resp->buf), len);
+    coap_opt_add_uint(&resp->pkt, COAP_OPT_MAX_AGE, 3600);
+    coap_opt_finish(&resp->pkt, COAP_OPT_FINISH_PAYLOAD);
+    resp->pkt.payload_len = 4;
+    memcpy(resp->pkt.payload, "21.5", 4);
+}
+
+typedef void (*bench_func_t)(unsigned i);
+
+static void _key(unsigned i)
+{
+    uint8_t cache_key[SHA256_DIGEST_LENGTH];
+
+    nanocoap_cache_key_generate(&_reqs[i % REQUESTS_NUMOF].pkt, cache_key);
+    _sink = cache_key[0];
+}
+
+static void _hit(unsigned i)
+{
+    _sink = (uintptr_t)nanocoap_cache_request_lookup(&_reqs[i % REQUESTS_NUMOF].pkt);
+}
+
+static void _miss(unsigned i)
+{
+    (void)i;
+    _sink = (uintptr_t)nanocoap_cache_request_lookup(&_reqs[REQUESTS_NUMOF].pkt);
+}
+
+static void _bench(const char *name, bench_func_t func)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t elapsed;
+    unsigned n = 0;
+
+    do {
+        func(n++);
+        elapsed = ztimer_now(ZTIMER_USEC) - start;
+    } while (elapsed < MEASURE_US);
+
+    printf("{ \"%s\" : %" PRIu32 " }\n", name,
+           (uint32_t)((uint64_t)elapsed * NS_PER_US / n));
+}
+
+int main(void)
+{
+    nanocoap_cache_init();
+    _build_resp(&_resp);
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs); i++) {
+        _build_req(&_reqs[i], i);
+    }
+    for (unsigned i = 0; i < REQUESTS_NUMOF; i++) {
+        expect(nanocoap_cache_add_by_req(&_reqs[i].pkt, &_resp.pkt,
+                                         coap_get_total_len(&_resp.pkt)));
+    }
+    for (unsigned i = 0; i < REQUESTS_NUMOF; i++) {
+        expect(nanocoap_cache_request_lookup(&_reqs[i].pkt));
+    }
+    expect(!nanocoap_cache_request_lookup(&_reqs[REQUESTS_NUMOF].pkt));
+
+    ztimer_acquire(ZTIMER_USEC);
+    printf("Latency in ns with %u cached responses:\n", REQUESTS_NUMOF);
+    _bench("key", _key);
+    _bench("hit", _hit);
+    _bench("miss", _miss);
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
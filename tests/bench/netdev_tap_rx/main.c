@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       RX throughput benchmark of the native TAP driver
+ *
+ * Counts the frames received through netdev_tap per second, without any
+ * network stack on top.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/ethernet.h"
+#include "net/netdev.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef BENCH_DURATION
+#define BENCH_DURATION  (5U)
+#endif
+
+#define FLAG_ISR        (0x1)
+#define FLAG_TICK       (0x2)
+
+static netdev_tap_t _tap;
+static thread_t *_main;
+static uint8_t _buf[ETHERNET_FRAME_LEN];
+static uint32_t _frames;
+static uint32_t _bytes;
+static int _last_len;
+
+static void _tick(void *arg)
+{
+    (void)arg;
+    thread_flags_set(_main, FLAG_TICK);
+}
+
+static ztimer_t _timer = { .callback = _tick };
+
+static void _event_cb(netdev_t *dev, netdev_event_t event)
+{
+    switch (event) {
+    case NETDEV_EVENT_ISR:
+        thread_flags_set(_main, FLAG_ISR);
+        break;
+    case NETDEV_EVENT_RX_COMPLETE: {
+        int len = dev->driver->recv(dev, NULL, 0, NULL);
+        if (len <= 0) {
+            break;
+        }
+        _last_len = len;
+        len = dev->driver->recv(dev, _buf, sizeof(_buf), NULL);
+        if (len > 0) {
+            _frames++;
+            _bytes += len;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+int main(void)
+{
+    netdev_t *dev = &_tap.netdev;
+    unsigned seconds = 0;
+
+    _main = thread_get_active();
+    netdev_tap_setup(&_tap, &netdev_tap_params[0], 0);
+    dev->event_callback = _event_cb;
+    if (dev->driver->init(dev) < 0) {
+        puts("init failed");
+        return 1;
+    }
+
+    puts("ready");
+    /* start measuring with the first frame */
+    thread_flags_wait_any(FLAG_ISR);
+    ztimer_set(ZTIMER_MSEC, &_timer, MS_PER_SEC);
+
+    while (seconds < BENCH_DURATION) {
+        thread_flags_t flags = thread_flags_wait_any(FLAG_ISR | FLAG_TICK);
+
+        if (flags & FLAG_ISR) {
+            dev->driver->isr(dev);
+        }
+        if (flags & FLAG_TICK) {
+            ztimer_set(ZTIMER_MSEC, &_timer, MS_PER_SEC);
+            printf("{ \"pps\" : %" PRIu32 ", \"Bps\" : %" PRIu32 ", \"len\" : %d }\n",
+                   _frames, _bytes, _last_len);
+            _frames = 0;
+            _bytes = 0;
+            seconds++;
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
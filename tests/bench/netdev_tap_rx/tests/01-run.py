@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import threading
+from testrunner import run
+
+FRAME_LEN = int(os.environ.get("FRAME_LEN", "128"))
+
+
+def flood(iface, stop):
+    sock = socket.socket(socket.AF_PACKET, socket.SOCK_RAW)
+    sock.bind((iface, 0))
+    # broadcast, so the driver does not filter the frames
+    frame = b"\xff" * 6 + b"\x02\x00\x00\x00\x00\x01" + b"\x88\xb5"
+    frame += bytes(FRAME_LEN - len(frame))
+    while not stop.is_set():
+        try:
+            sock.send(frame)
+        except OSError:
+            # host side queue is full, the driver does not keep up
+            pass
+
+
+def testfunc(child):
+    child.expect_exact("ready")
+    stop = threading.Event()
+    sender = threading.Thread(target=flood, args=(os.environ["PORT"], stop))
+    sender.start()
+    try:
+        child.expect(r"{ \"pps\" : \d+, \"Bps\" : \d+, \"len\" : %d }" % FRAME_LEN)
+        child.expect_exact("[SUCCESS]", timeout=30)
+    finally:
+        stop.set()
+        sender.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -25,6 +25,10 @@
 #include "thread.h"
 #include "thread_flags.h"
 
+#if IS_USED(MODULE_SCHED_LATENCY)
+#include "sched_latency.h"
+#endif
+
 #ifndef BENCH_RUNS
 #  define BENCH_RUNS          (1000UL * 1000UL)
 #endif
@@ -56,6 +60,8 @@ static thread_t *t;
 static thread_flags_t _flag = 0x0001;
 static msg_t _msg;
 static struct test_node nodes[BENCH_CLIST_SORT_TEST_NODES];
+static char _pong_stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_pong;
 
 static void _mutex_lockunlock(void)
 {
@@ -81,6 +87,39 @@ static void _flag_waitone(void)
     thread_flags_wait_one(_flag);
 }
 
+static void *_pong_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_flags_wait_any(_flag);
+        thread_flags_set(t, _flag);
+    }
+    return NULL;
+}
+
+/* wakes up the higher priority pong thread, which immediately preempts us */
+static void _flag_pingpong(void)
+{
+    thread_flags_set(_pong, _flag);
+    thread_flags_wait_any(_flag);
+}
+
+#if IS_USED(MODULE_SCHED_LATENCY)
+static void _print_sched_latency(uint8_t prio)
+{
+    sched_latency_stats_t stats;
+
+    sched_latency_get(prio, &stats);
+    printf("{'sched_latency': {'prio': %u, 'wakeups': %" PRIu32 ", "
+           "'max_us': %" PRIu32 ", 'preemptions': %" PRIu32 ", 'hist': [",
+           (unsigned)prio, stats.wakeups, stats.max_us, stats.preemptions);
+    for (unsigned i = 0; i < CONFIG_SCHED_LATENCY_BUCKETS; i++) {
+        printf("%s%" PRIu32, i ? ", " : "", stats.hist[i]);
+    }
+    puts("]}}");
+}
+#endif
+
 static clist_node_t clist;
 
 static int _insert_reversed_data(clist_node_t *item, void *arg)
@@ -277,6 +316,18 @@ int main(void)
     BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
     BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
     BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
+    puts("");
+    _pong = thread_get(thread_create(_pong_stack, sizeof(_pong_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _pong_thread, NULL, "pong"));
+#if IS_USED(MODULE_SCHED_LATENCY)
+    sched_latency_reset();
+#endif
+    BENCHMARK_FUNC("thread flags ping-pong", BENCH_RUNS, _flag_pingpong());
+#if IS_USED(MODULE_SCHED_LATENCY)
+    _print_sched_latency(THREAD_PRIORITY_MAIN - 1);
+    _print_sched_latency(THREAD_PRIORITY_MAIN);
+#endif
     puts("");
     BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
     BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the CRC implementations
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef BUF_SIZE
+#define BUF_SIZE        (1024U)
+#endif
+
+#ifndef MEASURE_US
+#define MEASURE_US      (200U * US_PER_MS)
+#endif
+
+static uint8_t _buf[BUF_SIZE];
+static volatile uint32_t _sink;
+
+typedef uint32_t (*crc_func_t)(const uint8_t *buf, size_t len);
+
+static uint32_t _crc32(const uint8_t *buf, size_t len)
+{
+    return crc32(buf, len);
+}
+
+static uint32_t _kermit(const uint8_t *buf, size_t len)
+{
+    return crc16_ccitt_kermit_calc(buf, len);
+}
+
+static uint32_t _false(const uint8_t *buf, size_t len)
+{
+    return crc16_ccitt_false_calc(buf, len);
+}
+
+static void _bench(const char *name, crc_func_t func, size_t offset)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t elapsed;
+    uint64_t bytes = 0;
+
+    do {
+        _sink = func(_buf + offset, sizeof(_buf) - offset);
+        bytes += sizeof(_buf) - offset;
+        elapsed = ztimer_now(ZTIMER_USEC) - start;
+    } while (elapsed < MEASURE_US);
+
+    /* bytes per µs equals MB/s */
+    uint32_t kbps = (bytes * 1000) / elapsed;
+
+    printf("{ \"%s\" : %" PRIu32 ".%03" PRIu32 " }\n", name,
+           kbps / 1000, kbps % 1000);
+}
+
+int main(void)
+{
+    static const uint8_t check[] = "123456789";
+    int res = 0;
+
+    /* check values from the CRC catalogue */
+    if (crc32(check, 9) != 0xcbf43926) {
+        puts("crc32 check value mismatch");
+        res = 1;
+    }
+    if (crc16_ccitt_kermit_calc(check, 9) != 0x2189) {
+        puts("crc16 kermit check value mismatch");
+        res = 1;
+    }
+    if (crc16_ccitt_false_calc(check, 9) != 0x29b1) {
+        puts("crc16 false check value mismatch");
+        res = 1;
+    }
+    if (res) {
+        return res;
+    }
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + 3;
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+    printf("Throughput in MB/s over %u byte buffers:\n", BUF_SIZE);
+    _bench("crc32", _crc32, 0);
+    _bench("crc32 unaligned", _crc32, 1);
+    _bench("crc16 kermit", _kermit, 0);
+    _bench("crc16 false", _false, 0);
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
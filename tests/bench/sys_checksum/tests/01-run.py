@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"Throughput in MB/s over \d+ byte buffers:")
+    for name in ("crc32", "crc32 unaligned", "crc16 kermit", "crc16 false"):
+        child.expect(r"{ \"%s\" : \d+\.\d+ }" % name)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
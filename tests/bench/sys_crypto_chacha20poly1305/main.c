@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Cycles per byte of ChaCha20-Poly1305 and its building blocks
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "crypto/chacha20poly1305.h"
+#include "crypto/poly1305.h"
+#include "periph_conf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef MEASURE_US
+#define MEASURE_US      (100U * US_PER_MS)
+#endif
+
+#define MAX_SIZE        (1024U)
+
+static const size_t _sizes[] = { 16, 64, 256, MAX_SIZE };
+
+static uint8_t _msg[MAX_SIZE];
+static uint8_t _cipher[MAX_SIZE + CHACHA20POLY1305_TAG_BYTES];
+/* encryption of a message of the size measured, input of _decrypt() */
+static uint8_t _sealed[MAX_SIZE + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t _key[CHACHA20POLY1305_KEY_BYTES];
+static uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES];
+static const uint8_t _aad[13];
+
+typedef int (*bench_func_t)(size_t len);
+typedef void (*prepare_func_t)(size_t len);
+
+static int _encrypt(size_t len)
+{
+    chacha20poly1305_encrypt(_cipher, _msg, len, _aad, sizeof(_aad), _key, _nonce);
+    return 0;
+}
+
+static void _seal(size_t len)
+{
+    chacha20poly1305_encrypt(_sealed, _msg, len, _aad, sizeof(_aad), _key, _nonce);
+}
+
+static int _decrypt(size_t len)
+{
+    size_t msglen;
+
+    if (chacha20poly1305_decrypt(_sealed, len + CHACHA20POLY1305_TAG_BYTES, _msg, &msglen,
+                                 _aad, sizeof(_aad), _key, _nonce) != 1) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _chacha20(size_t len)
+{
+    chacha20_encrypt_decrypt(_msg, _cipher, _key, _nonce, len);
+    return 0;
+}
+
+static int _poly1305(size_t len)
+{
+    poly1305_auth(_cipher, _msg, len, _key);
+    return 0;
+}
+
+/* @p prepare is called for each size before measuring, if not NULL */
+static int _bench(const char *name, bench_func_t func, prepare_func_t prepare)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        uint32_t start, elapsed;
+        uint64_t bytes = 0;
+
+        if (prepare) {
+            prepare(_sizes[i]);
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        do {
+            if (func(_sizes[i]) < 0) {
+                printf("%s %u failed\n", name, (unsigned)_sizes[i]);
+                return -1;
+            }
+            bytes += _sizes[i];
+            elapsed = ztimer_now(ZTIMER_USEC) - start;
+        } while (elapsed < MEASURE_US);
+
+        /* in hundredths of a cycle */
+        uint32_t cpb = ((uint64_t)elapsed * (CLOCK_CORECLOCK / 10000)) / bytes;
+
+        printf("{ \"%s %u\" : %" PRIu32 ".%02" PRIu32 " }\n", name, (unsigned)_sizes[i],
+               cpb / 100, cpb % 100);
+    }
+    return 0;
+}
+
+int main(void)
+{
+    size_t len;
+
+    for (unsigned i = 0; i < sizeof(_msg); i++) {
+        _msg[i] = i * 7 + 3;
+    }
+
+    /* round trip check before measuring */
+    _encrypt(sizeof(_msg));
+    memset(_msg, 0, sizeof(_msg));
+    if (!chacha20poly1305_decrypt(_cipher, sizeof(_cipher), _msg, &len, _aad, sizeof(_aad),
+                                  _key, _nonce) || (_msg[1] != 10)) {
+        puts("round trip failed");
+        return 1;
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+    printf("Cycles per byte at %" PRIu32 " Hz:\n", (uint32_t)CLOCK_CORECLOCK);
+    if ((_bench("encrypt", _encrypt, NULL) < 0) ||
+        (_bench("decrypt", _decrypt, _seal) < 0) ||
+        (_bench("chacha20", _chacha20, NULL) < 0) ||
+        (_bench("poly1305", _poly1305, NULL) < 0)) {
+        return 1;
+    }
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+SIZES = (16, 64, 256, 1024)
+
+
+def testfunc(child):
+    child.expect(r"Cycles per byte at \d+ Hz:")
+    for name in ("encrypt", "decrypt", "chacha20", "poly1305"):
+        for size in SIZES:
+            child.expect(r"{ \"%s %d\" : \d+\.\d+ }" % (name, size))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of the AES block cipher modes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef MEASURE_US
+#define MEASURE_US      (100U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Largest message size, larger sizes are skipped
+ */
+#ifndef BUF_SIZE
+#  ifdef CPU_NATIVE
+#    define BUF_SIZE    (64U * 1024U)
+#  else
+#    define BUF_SIZE    (4U * 1024U)
+#  endif
+#endif
+
+#define CCM_MAC_LEN     (16U)
+
+static const size_t _sizes[] = { 64, 1024, 64U * 1024U };
+
+static uint8_t _in[BUF_SIZE];
+static uint8_t _out[BUF_SIZE + CCM_MAC_LEN];
+static const uint8_t _key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t _nonce[12];
+static const uint8_t _aad[13];
+static cipher_t _cipher;
+
+typedef int (*bench_func_t)(size_t len);
+
+static int _ecb_encrypt(size_t len)
+{
+    return cipher_encrypt_ecb(&_cipher, _in, len, _out);
+}
+
+static int _ecb_decrypt(size_t len)
+{
+    return cipher_decrypt_ecb(&_cipher, _in, len, _out);
+}
+
+static int _cbc_encrypt(size_t len)
+{
+    uint8_t iv[16] = { 0 };
+
+    return cipher_encrypt_cbc(&_cipher, iv, _in, len, _out);
+}
+
+static int _cbc_decrypt(size_t len)
+{
+    uint8_t iv[16] = { 0 };
+
+    return cipher_decrypt_cbc(&_cipher, iv, _in, len, _out);
+}
+
+static int _ctr(size_t len)
+{
+    uint8_t ctr[16] = { 0 };
+
+    return cipher_encrypt_ctr(&_cipher, ctr, 8, _in, len, _out);
+}
+
+static int _ccm_encrypt(size_t len)
+{
+    return cipher_encrypt_ccm(&_cipher, _aad, sizeof(_aad), CCM_MAC_LEN, 3,
+                              _nonce, sizeof(_nonce), _in, len, _out);
+}
+
+static int _bench(const char *name, bench_func_t func)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        uint32_t start, elapsed;
+        uint64_t bytes = 0;
+
+        if (_sizes[i] > BUF_SIZE) {
+            continue;
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        do {
+            if (func(_sizes[i]) < 0) {
+                printf("%s failed\n", name);
+                return -1;
+            }
+            bytes += _sizes[i];
+            elapsed = ztimer_now(ZTIMER_USEC) - start;
+        } while (elapsed < MEASURE_US);
+
+        printf("{ \"%s %u\" : %" PRIu32 " }\n", name, (unsigned)_sizes[i],
+               (uint32_t)((bytes * US_PER_MS) / elapsed));
+    }
+    return 0;
+}
+
+int main(void)
+{
+    static const struct {
+        const char *name;
+        bench_func_t func;
+    } benches[] = {
+        { "ecb encrypt", _ecb_encrypt },
+        { "ecb decrypt", _ecb_decrypt },
+        { "cbc encrypt", _cbc_encrypt },
+        { "cbc decrypt", _cbc_decrypt },
+        { "ctr", _ctr },
+        { "ccm encrypt", _ccm_encrypt },
+    };
+
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i * 7 + 3;
+    }
+    if (cipher_init(&_cipher, CIPHER_AES, _key, sizeof(_key)) != CIPHER_INIT_SUCCESS) {
+        puts("cipher_init failed");
+        return 1;
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+    puts("Throughput in kB/s:");
+    for (unsigned i = 0; i < ARRAY_SIZE(benches); i++) {
+        if (_bench(benches[i].name, benches[i].func) < 0) {
+            return 1;
+        }
+    }
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
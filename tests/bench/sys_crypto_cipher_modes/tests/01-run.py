@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+MODES = ("ecb encrypt", "ecb decrypt", "cbc encrypt", "cbc decrypt", "ctr",
+         "ccm encrypt")
+
+
+def testfunc(child):
+    child.expect_exact("Throughput in kB/s:")
+    for mode in MODES:
+        # 64 KiB is only measured where the buffer is large enough
+        for size in (64, 1024):
+            child.expect(r"{ \"%s %d\" : \d+ }" % (mode, size))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
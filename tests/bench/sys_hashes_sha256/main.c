@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of SHA-256, SHA-256 chains and PBKDF2
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "hashes/pbkdf2.h"
+#include "hashes/sha256.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef MEASURE_US
+#define MEASURE_US      (100U * US_PER_MS)
+#endif
+
+#ifndef BUF_SIZE
+#define BUF_SIZE        (1024U)
+#endif
+
+/**
+ * @brief   Chain steps and PBKDF2 iterations per call
+ */
+#define STEPS           (100U)
+
+static uint8_t _buf[BUF_SIZE];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+
+typedef void (*bench_func_t)(void);
+
+static void _sha256(void)
+{
+    sha256(_buf, sizeof(_buf), _digest);
+}
+
+static void _chain(void)
+{
+    sha256_chain(_digest, sizeof(_digest), STEPS, _digest);
+}
+
+static void _pbkdf2(void)
+{
+    pbkdf2_sha256("password", 8, "salt", 4, STEPS, _digest);
+}
+
+/* returns the number of calls per second */
+static uint32_t _bench(bench_func_t func)
+{
+    uint32_t start, elapsed;
+    uint32_t calls = 0;
+
+    start = ztimer_now(ZTIMER_USEC);
+    do {
+        func();
+        calls++;
+        elapsed = ztimer_now(ZTIMER_USEC) - start;
+    } while (elapsed < MEASURE_US);
+
+    return ((uint64_t)calls * US_PER_SEC) / elapsed;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + 3;
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+    printf("{ \"sha256 kB/s\" : %" PRIu32 " }\n",
+           (uint32_t)(((uint64_t)_bench(_sha256) * sizeof(_buf)) / 1000));
+    printf("{ \"chain steps/s\" : %" PRIu32 " }\n", _bench(_chain) * STEPS);
+    printf("{ \"pbkdf2 iterations/s\" : %" PRIu32 " }\n", _bench(_pbkdf2) * STEPS);
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
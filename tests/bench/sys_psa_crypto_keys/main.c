@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Rate of PSA key lookups and HMAC operations depending on the
+ *              number of keys loaded
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "psa/crypto.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef MEASURE_US
+#define MEASURE_US      (100U * US_PER_MS)
+#endif
+
+#define ALG             PSA_ALG_HMAC(PSA_ALG_SHA_256)
+#define KEY_LEN         (32U)
+#define MSG_LEN         (64U)
+
+static const unsigned _key_nums[] = { 1, 16, 64 };
+
+static psa_key_id_t _keys[64];
+static unsigned _keys_num;
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+/* More persistent keys than slots, so that they are loaded from storage */
+#define PERSISTENT_KEYS_NUM (CONFIG_PSA_SINGLE_KEY_COUNT + 16)
+
+static psa_key_id_t _persistent_keys[PERSISTENT_KEYS_NUM];
+#endif
+static uint8_t _msg[MSG_LEN];
+static uint8_t _mac[PSA_HASH_LENGTH(PSA_ALG_SHA_256)];
+
+typedef psa_status_t (*bench_func_t)(psa_key_id_t key);
+
+static psa_status_t _attributes(psa_key_id_t key)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+
+    return psa_get_key_attributes(key, &attr);
+}
+
+static psa_status_t _mac_compute(psa_key_id_t key)
+{
+    size_t mac_len;
+
+    return psa_mac_compute(key, ALG, _msg, sizeof(_msg), _mac, sizeof(_mac), &mac_len);
+}
+
+static psa_key_attributes_t _key_attributes(void)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+
+    psa_set_key_algorithm(&attr, ALG);
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_SIGN_MESSAGE);
+    psa_set_key_bits(&attr, PSA_BYTES_TO_BITS(KEY_LEN));
+    psa_set_key_type(&attr, PSA_KEY_TYPE_HMAC);
+
+    return attr;
+}
+
+static int _add_keys(unsigned num)
+{
+    psa_key_attributes_t attr = _key_attributes();
+    uint8_t key[KEY_LEN];
+
+    for (; _keys_num < num; _keys_num++) {
+        memset(key, _keys_num, sizeof(key));
+        if (psa_import_key(&attr, key, sizeof(key), &_keys[_keys_num]) != PSA_SUCCESS) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Uses the keys in turn and reports the result for @p keys_num keys loaded */
+static int _bench(const char *name, bench_func_t func, unsigned keys_num,
+                  const psa_key_id_t *keys, unsigned keys_used)
+{
+    uint32_t start, elapsed;
+    uint32_t calls = 0;
+    unsigned i = 0;
+
+    start = ztimer_now(ZTIMER_USEC);
+    do {
+        if (func(keys[i]) != PSA_SUCCESS) {
+            printf("%s failed\n", name);
+            return -1;
+        }
+        if (++i == keys_used) {
+            i = 0;
+        }
+        calls++;
+        elapsed = ztimer_now(ZTIMER_USEC) - start;
+    } while (elapsed < MEASURE_US);
+
+    printf("{ \"%s %u\" : %" PRIu32 " }\n", name, keys_num,
+           (uint32_t)(((uint64_t)calls * US_PER_SEC) / elapsed));
+    return 0;
+}
+
+/* Uses the key imported last, which is the last one found by a linear search */
+static int _bench_volatile(const char *name, bench_func_t func)
+{
+    return _bench(name, func, _keys_num, &_keys[_keys_num - 1], 1);
+}
+
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+/* Uses all persistent keys in turn, so that the least recently used key
+ * is evicted and the next one has to be read from storage on each call */
+static int _bench_persistent(void)
+{
+    psa_key_attributes_t attr = _key_attributes();
+    uint8_t key[KEY_LEN];
+    int res;
+
+    /* the volatile keys occupy all slots and cannot be evicted */
+    for (unsigned i = 0; i < _keys_num; i++) {
+        psa_destroy_key(_keys[i]);
+    }
+    _keys_num = 0;
+
+    psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_PERSISTENT);
+    for (unsigned i = 0; i < PERSISTENT_KEYS_NUM; i++) {
+        _persistent_keys[i] = PSA_KEY_ID_USER_MIN + i;
+        /* left over from an earlier run that did not finish */
+        psa_destroy_key(_persistent_keys[i]);
+        psa_set_key_id(&attr, _persistent_keys[i]);
+        memset(key, i, sizeof(key));
+        if (psa_import_key(&attr, key, sizeof(key), &_persistent_keys[i]) != PSA_SUCCESS) {
+            puts("psa_import_key failed");
+            return -1;
+        }
+    }
+
+    res = _bench("persistent attributes", _attributes, PERSISTENT_KEYS_NUM,
+                 _persistent_keys, PERSISTENT_KEYS_NUM);
+    if (res == 0) {
+        res = _bench("persistent mac", _mac_compute, PERSISTENT_KEYS_NUM,
+                     _persistent_keys, PERSISTENT_KEYS_NUM);
+    }
+
+    for (unsigned i = 0; i < PERSISTENT_KEYS_NUM; i++) {
+        psa_destroy_key(_persistent_keys[i]);
+    }
+    return res;
+}
+#endif
+
+int main(void)
+{
+    if (psa_crypto_init() != PSA_SUCCESS) {
+        puts("psa_crypto_init failed");
+        return 1;
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+    puts("Operations per second:");
+    for (unsigned i = 0; i < ARRAY_SIZE(_key_nums); i++) {
+        if (_add_keys(_key_nums[i]) < 0) {
+            puts("psa_import_key failed");
+            return 1;
+        }
+        if ((_bench_volatile("attributes", _attributes) < 0) ||
+            (_bench_volatile("mac", _mac_compute) < 0)) {
+            return 1;
+        }
+    }
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+    if (_bench_persistent() < 0) {
+        return 1;
+    }
+#endif
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Operations per second:")
+    for keys in (1, 16, 64):
+        for op in ("attributes", "mac"):
+            child.expect(r"{ \"%s %d\" : \d+ }" % (op, keys))
+    # only with module psa_persistent_storage
+    if child.expect([r"{ \"persistent attributes \d+\" : \d+ }",
+                     r"\[SUCCESS\]"]) == 0:
+        child.expect(r"{ \"persistent mac \d+\" : \d+ }")
+        child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -88,6 +88,58 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/*
+ * Measures set() and remove() of the middle timer while 'depth' timers are
+ * queued. ztimer runs both operations completely with interrupts disabled, so
+ * the maximum duration of a single operation is also the worst case time
+ * interrupts are kept disabled by it.
+ */
+static void _bench_depth(unsigned depth, uint32_t start)
+{
+    char desc[32];
+    uint32_t before, diff, max_set = 0, max_remove = 0;
+    uint32_t total_set = 0, total_remove = 0;
+    unsigned middle = depth / 2;
+
+    _base = BASE - (ztimer_now(ZTIMER_USEC) - start);
+    for (unsigned n = 0; n < depth; n++) {
+        _timer_set(n);
+    }
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        _base = BASE - (ztimer_now(ZTIMER_USEC) - start);
+
+        before = ztimer_now(ZTIMER_USEC);
+        _timer_remove(middle);
+        diff = ztimer_now(ZTIMER_USEC) - before;
+        total_remove += diff;
+        if (diff > max_remove) {
+            max_remove = diff;
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        _timer_set(middle);
+        diff = ztimer_now(ZTIMER_USEC) - before;
+        total_set += diff;
+        if (diff > max_set) {
+            max_set = diff;
+        }
+    }
+
+    snprintf(desc, sizeof(desc), "set() middle of %u", depth);
+    _print_result(desc, REPEAT, total_set);
+    snprintf(desc, sizeof(desc), "set() max of %u", depth);
+    _print_result(desc, 1, max_set);
+    snprintf(desc, sizeof(desc), "remove() middle of %u", depth);
+    _print_result(desc, REPEAT, total_remove);
+    snprintf(desc, sizeof(desc), "remove() max of %u", depth);
+    _print_result(desc, 1, max_remove);
+
+    for (unsigned n = 0; n < depth; n++) {
+        _timer_remove(n);
+    }
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -285,6 +337,15 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * test set() / remove() cost against the number of queued timers
+     *
+     */
+    for (unsigned depth = 1; depth <= NUMOF_TIMERS; depth *= 10) {
+        _bench_depth(depth, start);
+        expect(!_triggers);
+    }
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
     puts("done.");
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test msg_send_many() and msg_receive_many()
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (8U)
+#define NUMOF_MSGS      (4 * QUEUE_SIZE + 3)
+
+static char _receiver_stack[THREAD_STACKSIZE_MAIN];
+static char _sender_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _receiver_queue[QUEUE_SIZE];
+static msg_t _main_queue[QUEUE_SIZE];
+
+static unsigned _received;
+static unsigned _calls;
+static bool _sender_done;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t buf[QUEUE_SIZE];
+
+    msg_init_queue(_receiver_queue, QUEUE_SIZE);
+    while (1) {
+        int n = msg_receive_many(buf, ARRAY_SIZE(buf));
+
+        expect((n > 0) && (n <= (int)ARRAY_SIZE(buf)));
+        for (int i = 0; i < n; i++) {
+            expect(buf[i].content.value == _received++);
+        }
+        _calls++;
+    }
+
+    return NULL;
+}
+
+static void *_sender(void *arg)
+{
+    msg_t msg = { .type = 1, .content.value = QUEUE_SIZE };
+
+    msg_send(&msg, (kernel_pid_t)(intptr_t)arg);
+    _sender_done = true;
+
+    return NULL;
+}
+
+static void _test_send_receive_many(void)
+{
+    msg_t msgs[NUMOF_MSGS];
+    kernel_pid_t pid = thread_create(_receiver_stack, sizeof(_receiver_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _receiver, NULL, "receiver");
+
+    for (unsigned i = 0; i < NUMOF_MSGS; i++) {
+        msgs[i].type = 0;
+        msgs[i].content.value = i;
+    }
+
+    /* queue runs full, so this has to block a few times */
+    expect(msg_send_many(msgs, NUMOF_MSGS, pid) == NUMOF_MSGS);
+    expect(_received == NUMOF_MSGS);
+    printf("%u messages received in %u calls\n", _received, _calls);
+    expect(_calls < NUMOF_MSGS);
+
+    expect(msg_send_many(msgs, 1, KERNEL_PID_LAST) == -1);
+}
+
+static void _test_try_many_self(void)
+{
+    msg_t msgs[QUEUE_SIZE + 2];
+    msg_t buf[QUEUE_SIZE];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].type = 0;
+        msgs[i].content.value = i;
+    }
+
+    expect(msg_try_receive_many(buf, ARRAY_SIZE(buf)) == 0);
+    expect(msg_try_send_many(msgs, ARRAY_SIZE(msgs), thread_getpid())
+           == QUEUE_SIZE);
+    expect(msg_try_receive_many(buf, 5) == 5);
+    expect(msg_try_receive_many(&buf[5], ARRAY_SIZE(buf)) == QUEUE_SIZE - 5);
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        expect(buf[i].content.value == i);
+        expect(buf[i].sender_pid == thread_getpid());
+    }
+    expect(msg_try_receive_many(buf, ARRAY_SIZE(buf)) == 0);
+}
+
+static void _test_receive_many_waiters(void)
+{
+    msg_t msgs[QUEUE_SIZE];
+    msg_t buf[QUEUE_SIZE + 1];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].type = 0;
+        msgs[i].content.value = i;
+    }
+    expect(msg_try_send_many(msgs, QUEUE_SIZE, thread_getpid()) == QUEUE_SIZE);
+
+    /* sender finds the queue full and blocks */
+    kernel_pid_t pid = thread_create(_sender_stack, sizeof(_sender_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0, _sender,
+                                     (void *)(intptr_t)thread_getpid(),
+                                     "sender");
+    expect(!_sender_done);
+
+    /* the sender's message is taken after the queued ones and the sender is
+     * woken up (and runs) right away */
+    expect(msg_try_receive_many(buf, ARRAY_SIZE(buf)) == QUEUE_SIZE + 1);
+    expect(_sender_done);
+    for (unsigned i = 0; i < ARRAY_SIZE(buf); i++) {
+        expect(buf[i].content.value == i);
+    }
+    expect(buf[QUEUE_SIZE].sender_pid == pid);
+    expect(buf[QUEUE_SIZE].type == 1);
+}
+
+int main(void)
+{
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+
+    _test_send_receive_many();
+    _test_try_many_self();
+    _test_receive_many_waiters();
+
+    puts("[SUCCESS]");
+    return 0;
+}
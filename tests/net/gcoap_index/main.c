@@ -0,0 +1,368 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test matching of responses, Observe registrations and
+ *              resources in gcoap
+ *
+ * All requests are sent to gcoap itself or to a plain UDP sock via the IPv6
+ * loopback address.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NUMOF_PATHS         (40U)
+#define PEER_PORT           (5690U)
+#define WAIT_MS             (1000U)
+
+typedef struct {
+    int state;
+    unsigned code;
+    bool observe;
+    char payload[16];
+} _resp_t;
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx);
+static int _matcher(gcoap_listener_t *listener,
+                    const coap_resource_t **resource, coap_pkt_t *pdu);
+
+static char _paths[NUMOF_PATHS][8];
+static coap_resource_t _res_many[NUMOF_PATHS];
+
+static const coap_resource_t _res_a[] = {
+    { "/dup", COAP_GET, _handler, "A" },
+    { "/same", COAP_GET | COAP_POST, _handler, "first" },
+    { "/same", COAP_GET, _handler, "second" },
+};
+
+static const coap_resource_t _res_b[] = {
+    { "/dup", COAP_POST, _handler, "B" },
+    { "/obs", COAP_GET, _handler, "obs" },
+    { "/sub", COAP_GET | COAP_MATCH_SUBTREE, _handler, "sub" },
+};
+
+static const coap_resource_t _res_err[] = {
+    { "/err", COAP_GET, _handler, "err" },
+};
+
+static gcoap_listener_t _listener_many = {
+    .resources = _res_many,
+    .resources_len = ARRAY_SIZE(_res_many),
+};
+
+static gcoap_listener_t _listener_a = {
+    .resources = _res_a,
+    .resources_len = ARRAY_SIZE(_res_a),
+};
+
+static gcoap_listener_t _listener_b = {
+    .resources = _res_b,
+    .resources_len = ARRAY_SIZE(_res_b),
+};
+
+static gcoap_listener_t _listener_err = {
+    .resources = _res_err,
+    .resources_len = ARRAY_SIZE(_res_err),
+    .request_matcher = _matcher,
+};
+
+static sock_udp_ep_t _gcoap_ep = {
+    .family = AF_INET6,
+    .netif = SOCK_ADDR_ANY_NETIF,
+    .port = CONFIG_GCOAP_PORT,
+};
+
+static sock_udp_ep_t _peer_ep = {
+    .family = AF_INET6,
+    .netif = SOCK_ADDR_ANY_NETIF,
+    .port = PEER_PORT,
+};
+
+static _resp_t _resps[NUMOF_PATHS];
+static volatile unsigned _resps_done;
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    const char *payload = coap_request_ctx_get_context(ctx);
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    ssize_t res = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    memcpy(pdu->payload, payload, strlen(payload));
+    return res + strlen(payload);
+}
+
+static int _matcher(gcoap_listener_t *listener,
+                    const coap_resource_t **resource, coap_pkt_t *pdu)
+{
+    (void)listener;
+    (void)resource;
+    char uri[CONFIG_NANOCOAP_URI_MAX];
+
+    if ((coap_get_uri_path(pdu, (uint8_t *)uri) > 0) &&
+        (strncmp(uri, "/err", 4) == 0)) {
+        return GCOAP_RESOURCE_ERROR;
+    }
+    return GCOAP_RESOURCE_NO_PATH;
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+    _resp_t *resp = &_resps[(uintptr_t)memo->context];
+
+    resp->state = memo->state;
+    if ((memo->state == GCOAP_MEMO_RESP) && (pdu->payload_len < sizeof(resp->payload))) {
+        resp->code = coap_get_code_decimal(pdu);
+        resp->observe = coap_has_observe(pdu);
+        memcpy(resp->payload, pdu->payload, pdu->payload_len);
+        resp->payload[pdu->payload_len] = '\0';
+    }
+    _resps_done++;
+}
+
+static void _wait_resps(unsigned numof)
+{
+    for (unsigned i = 0; (_resps_done < numof) && (i < WAIT_MS); i++) {
+        ztimer_sleep(ZTIMER_MSEC, 1);
+    }
+    expect(_resps_done == numof);
+}
+
+static size_t _req_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                        unsigned code, const char *path, uint8_t type,
+                        int observe)
+{
+    /* Observe goes before Uri-Path */
+    expect(gcoap_req_init(pdu, buf, len, code, NULL) == 0);
+    coap_pkt_set_type(pdu, type);
+    if (observe >= 0) {
+        coap_opt_add_uint(pdu, COAP_OPT_OBSERVE, observe);
+    }
+    coap_opt_add_uri_path(pdu, path);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static void _send(unsigned code, const char *path, unsigned idx,
+                  const sock_udp_ep_t *remote, uint8_t type)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    size_t len = _req_init(&pdu, buf, sizeof(buf), code, path, type, -1);
+
+    memset(&_resps[idx], 0, sizeof(_resps[idx]));
+    expect(gcoap_req_send(buf, len, remote, NULL, _resp_handler,
+                          (void *)(uintptr_t)idx, GCOAP_SOCKET_TYPE_UNDEF) > 0);
+}
+
+static void _expect_resp(unsigned code, const char *path, unsigned resp_code,
+                         const char *payload)
+{
+    _resps_done = 0;
+    _send(code, path, 0, &_gcoap_ep, COAP_TYPE_NON);
+    _wait_resps(1);
+    expect(_resps[0].state == GCOAP_MEMO_RESP);
+    expect(_resps[0].code == resp_code);
+    if (payload) {
+        expect(strcmp(_resps[0].payload, payload) == 0);
+    }
+}
+
+static void test_many_open_requests(void)
+{
+    puts("test_many_open_requests");
+    _resps_done = 0;
+    /* gcoap handles the requests in between, but the responses are only
+     * matched once all requests are out */
+    for (unsigned i = 0; i < NUMOF_PATHS; i++) {
+        _send(COAP_METHOD_GET, _paths[i], i, &_gcoap_ep, COAP_TYPE_NON);
+    }
+    _wait_resps(NUMOF_PATHS);
+    for (unsigned i = 0; i < NUMOF_PATHS; i++) {
+        expect(_resps[i].state == GCOAP_MEMO_RESP);
+        expect(_resps[i].code == 205);
+        expect(strcmp(_resps[i].payload, _paths[i]) == 0);
+    }
+}
+
+static void test_resource_matching(void)
+{
+    puts("test_resource_matching");
+    _expect_resp(COAP_METHOD_GET, "/dup", 205, "A");
+    _expect_resp(COAP_METHOD_POST, "/dup", 205, "B");
+    _expect_resp(COAP_METHOD_PUT, "/dup", 405, NULL);
+    _expect_resp(COAP_METHOD_GET, "/same", 205, "first");
+    _expect_resp(COAP_METHOD_GET, "/sub", 205, "sub");
+    _expect_resp(COAP_METHOD_GET, "/sub/a/b", 205, "sub");
+    _expect_resp(COAP_METHOD_GET, "/subway", 205, "sub");
+    _expect_resp(COAP_METHOD_POST, "/sub/a", 405, NULL);
+    _expect_resp(COAP_METHOD_GET, "/su", 404, NULL);
+    _expect_resp(COAP_METHOD_GET, "/a/", 404, NULL);
+    _expect_resp(COAP_METHOD_GET, "/err", 500, NULL);
+    /* the default listener is still there, too */
+    _expect_resp(COAP_METHOD_PUT, "/.well-known/core", 405, NULL);
+}
+
+static void test_rst(sock_udp_t *sock)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    sock_udp_ep_t remote;
+    coap_pkt_t pdu;
+
+    puts("test_rst");
+    _resps_done = 0;
+    _send(COAP_METHOD_GET, "/peer", 0, &_peer_ep, COAP_TYPE_CON);
+    ssize_t len = sock_udp_recv(sock, buf, sizeof(buf), WAIT_MS * US_PER_MS,
+                                &remote);
+    expect(len > 0);
+    expect(coap_parse_udp(&pdu, buf, len) >= 0);
+
+    /* reset the request: gcoap must find the request by message ID */
+    coap_pkt_set_type(&pdu, COAP_TYPE_RST);
+    coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
+    coap_pkt_set_tkl(&pdu, 0);
+    expect(sock_udp_send(sock, buf, sizeof(coap_udp_hdr_t), &remote) > 0);
+    _wait_resps(1);
+    expect(_resps[0].state == GCOAP_MEMO_TIMEOUT);
+}
+
+static void test_separate_response(sock_udp_t *sock)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    sock_udp_ep_t remote;
+    coap_pkt_t pdu;
+
+    puts("test_separate_response");
+    _resps_done = 0;
+    _send(COAP_METHOD_GET, "/peer", 0, &_peer_ep, COAP_TYPE_CON);
+    ssize_t len = sock_udp_recv(sock, buf, sizeof(buf), WAIT_MS * US_PER_MS,
+                                &remote);
+    expect(len > 0);
+    expect(coap_parse_udp(&pdu, buf, len) >= 0);
+
+    unsigned mid = coap_get_id(&pdu);
+    unsigned tkl = coap_get_token_len(&pdu);
+
+    memcpy(token, coap_get_token(&pdu), tkl);
+
+    /* empty ACK stops retransmissions, matched by message ID */
+    coap_pkt_set_type(&pdu, COAP_TYPE_ACK);
+    coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
+    coap_pkt_set_tkl(&pdu, 0);
+    expect(sock_udp_send(sock, buf, sizeof(coap_udp_hdr_t), &remote) > 0);
+
+    /* separate response is matched by token */
+    len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_CON, token, tkl,
+                             COAP_CODE_CONTENT, mid + 1);
+    buf[len++] = 0xff;
+    memcpy(&buf[len], "sep", 3);
+    len += 3;
+    expect(sock_udp_send(sock, buf, len, &remote) > 0);
+
+    /* which gcoap acknowledges */
+    len = sock_udp_recv(sock, buf, sizeof(buf), WAIT_MS * US_PER_MS, &remote);
+    expect(len == sizeof(coap_udp_hdr_t));
+    expect(coap_parse_udp(&pdu, buf, len) >= 0);
+    expect(coap_get_type(&pdu) == COAP_TYPE_ACK);
+    expect(coap_get_id(&pdu) == ((mid + 1) & 0xffff));
+
+    _wait_resps(1);
+    expect(_resps[0].state == GCOAP_MEMO_RESP);
+    expect(strcmp(_resps[0].payload, "sep") == 0);
+}
+
+static void test_observe(void)
+{
+    const coap_resource_t *obs = &_res_b[1];
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    coap_pkt_t pdu;
+    unsigned tkl;
+    size_t len;
+
+    puts("test_observe");
+    expect(gcoap_obs_init(&pdu, buf, sizeof(buf), obs) == GCOAP_OBS_INIT_UNUSED);
+
+    /* register */
+    _resps_done = 0;
+    memset(&_resps[0], 0, sizeof(_resps[0]));
+    len = _req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, obs->path,
+                    COAP_TYPE_NON, COAP_OBS_REGISTER);
+    tkl = coap_get_token_len(&pdu);
+    memcpy(token, coap_get_token(&pdu), tkl);
+    expect(gcoap_req_send(buf, len, &_gcoap_ep, NULL, _resp_handler, 0,
+                          GCOAP_SOCKET_TYPE_UNDEF) > 0);
+    _wait_resps(1);
+    expect(_resps[0].observe);
+    expect(strcmp(_resps[0].payload, "obs") == 0);
+
+    /* notify, the client memo is still there to match */
+    expect(gcoap_obs_init(&pdu, buf, sizeof(buf), obs) == GCOAP_OBS_INIT_OK);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pdu.payload, "n1", 2);
+    expect(gcoap_obs_send(buf, len + 2, obs) > 0);
+    _wait_resps(2);
+    expect(_resps[0].observe);
+    expect(strcmp(_resps[0].payload, "n1") == 0);
+
+    /* deregister with the same token */
+    expect(gcoap_obs_req_forget(&_gcoap_ep, token, tkl) == 0);
+    len = _req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, obs->path,
+                    COAP_TYPE_NON, COAP_OBS_DEREGISTER);
+    expect(coap_get_token_len(&pdu) == tkl);
+    memcpy(coap_get_token(&pdu), token, tkl);
+    expect(gcoap_req_send(buf, len, &_gcoap_ep, NULL, _resp_handler, 0,
+                          GCOAP_SOCKET_TYPE_UNDEF) > 0);
+    _wait_resps(3);
+    expect(!_resps[0].observe);
+    expect(gcoap_obs_init(&pdu, buf, sizeof(buf), obs) == GCOAP_OBS_INIT_UNUSED);
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PEER_PORT };
+    sock_udp_t sock;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)_gcoap_ep.addr.ipv6);
+    ipv6_addr_set_loopback((ipv6_addr_t *)_peer_ep.addr.ipv6);
+    for (unsigned i = 0; i < NUMOF_PATHS; i++) {
+        snprintf(_paths[i], sizeof(_paths[i]), "/a/%u", i);
+        _res_many[i].path = _paths[i];
+        _res_many[i].methods = COAP_GET;
+        _res_many[i].handler = _handler;
+        _res_many[i].context = _paths[i];
+    }
+    gcoap_register_listener(&_listener_err);
+    gcoap_register_listener(&_listener_b);
+    gcoap_register_listener(&_listener_a);
+    gcoap_register_listener(&_listener_many);
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    test_many_open_requests();
+    test_resource_matching();
+    test_rst(&sock);
+    test_separate_response(&sock);
+    test_observe();
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Load generator for the gcoap worker threads
+ *
+ * One client keeps requesting a resource whose handler blocks for
+ * @ref SLOW_MS, the other clients request a resource that is answered right
+ * away. All requests are sent to gcoap via the IPv6 loopback address. The
+ * throughput and the latency of the fast requests are reported.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define CLIENTS_NUMOF       (4U)
+#define CLIENT_PORT         (5690U)
+#define DURATION_MS         (1000U)
+#define SLOW_MS             (20U)
+#define WAIT_MS             (1000U)
+
+/* latencies are counted in buckets of BUCKET_US, the last one also counts
+ * everything above */
+#define BUCKET_US           (100U)
+#define BUCKETS_NUMOF       (1024U)
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+#define WORKERS_NUMOF       CONFIG_GCOAP_WORKERS_NUMOF
+#else
+#define WORKERS_NUMOF       (0U)
+#endif
+
+typedef struct {
+    const char *path;
+    uint16_t port;
+    unsigned done;              /**< successful requests */
+    unsigned rejected;          /**< requests answered with 5.03 */
+} _client_t;
+
+static ssize_t _fast_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx);
+static ssize_t _slow_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx);
+
+static const coap_resource_t _resources[] = {
+    { "/fast", COAP_GET, _fast_handler, NULL },
+    { "/slow", COAP_GET, _slow_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static char _stacks[CLIENTS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static _client_t _clients[CLIENTS_NUMOF];
+static msg_t _main_queue[CLIENTS_NUMOF];
+
+static mutex_t _hist_lock = MUTEX_INIT;
+static uint32_t _hist[BUCKETS_NUMOF];
+static uint32_t _start;
+static kernel_pid_t _main_pid;
+
+static ssize_t _fast_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static ssize_t _slow_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    /* e.g. a file read from slow storage */
+    ztimer_sleep(ZTIMER_MSEC, SLOW_MS);
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static void _record(uint32_t latency)
+{
+    unsigned bucket = latency / BUCKET_US;
+
+    if (bucket >= BUCKETS_NUMOF) {
+        bucket = BUCKETS_NUMOF - 1;
+    }
+    mutex_lock(&_hist_lock);
+    _hist[bucket]++;
+    mutex_unlock(&_hist_lock);
+}
+
+static uint32_t _percentile(unsigned percent)
+{
+    uint32_t total = 0;
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < BUCKETS_NUMOF; i++) {
+        total += _hist[i];
+    }
+    for (unsigned i = 0; i < BUCKETS_NUMOF; i++) {
+        sum += _hist[i];
+        if (sum * 100 >= total * percent) {
+            return (i + 1) * BUCKET_US;
+        }
+    }
+    return BUCKETS_NUMOF * BUCKET_US;
+}
+
+/* Sends a request and waits for the response, returns its code or 0 on
+ * timeout */
+static unsigned _request(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         const char *path, uint16_t id)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    ssize_t len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_CON, &id,
+                                     sizeof(id), COAP_METHOD_GET, id);
+    expect(len > 0);
+    coap_pkt_init(&pdu, buf, sizeof(buf), len);
+    coap_opt_add_uri_path(&pdu, path);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    expect(sock_udp_send(sock, buf, len, remote) == len);
+
+    while (1) {
+        len = sock_udp_recv(sock, buf, sizeof(buf), WAIT_MS * US_PER_MS, NULL);
+        if (len <= 0) {
+            return 0;
+        }
+        if ((coap_parse_udp(&pdu, buf, len) >= 0) && (coap_get_id(&pdu) == id)) {
+            return coap_get_code_raw(&pdu);
+        }
+    }
+}
+
+static void *_client(void *arg)
+{
+    _client_t *client = arg;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = client->port };
+    sock_udp_ep_t remote = {
+        .family = AF_INET6,
+        .netif = SOCK_ADDR_ANY_NETIF,
+        .port = CONFIG_GCOAP_PORT,
+    };
+    sock_udp_t sock;
+    uint16_t id = client->port << 8;
+    bool fast = (client->path == _resources[0].path);
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)remote.addr.ipv6);
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    while ((ztimer_now(ZTIMER_USEC) - _start) < DURATION_MS * US_PER_MS) {
+        uint32_t sent = ztimer_now(ZTIMER_USEC);
+        unsigned code = _request(&sock, &remote, client->path, id++);
+
+        if (code == COAP_CODE_SERVICE_UNAVAILABLE) {
+            client->rejected++;
+        }
+        else {
+            expect(code == COAP_CODE_CONTENT);
+            client->done++;
+            if (fast) {
+                _record(ztimer_now(ZTIMER_USEC) - sent);
+            }
+        }
+        /* the response is usually received without blocking, let the other
+         * clients send as well */
+        thread_yield();
+    }
+    sock_udp_close(&sock);
+
+    msg_t msg;
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+int main(void)
+{
+    msg_init_queue(_main_queue, ARRAY_SIZE(_main_queue));
+    _main_pid = thread_getpid();
+    gcoap_register_listener(&_listener);
+
+    ztimer_acquire(ZTIMER_USEC);
+    _start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        _clients[i].path = (i == 0) ? _resources[1].path : _resources[0].path;
+        _clients[i].port = CLIENT_PORT + i;
+        /* below the workers, so the load generator does not starve them */
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      0, _client, &_clients[i], "client");
+    }
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        msg_t msg;
+        msg_receive(&msg);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - _start;
+    ztimer_release(ZTIMER_USEC);
+
+    unsigned done = 0;
+    unsigned rejected = 0;
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        done += _clients[i].done;
+        rejected += _clients[i].rejected;
+    }
+    uint32_t p50 = _percentile(50);
+    uint32_t p99 = _percentile(99);
+
+    printf("workers: %u\n", (unsigned)WORKERS_NUMOF);
+    printf("requests: %u, rejected: %u, slow: %u\n", done, rejected,
+           _clients[0].done);
+    printf("requests/s: %" PRIu32 "\n",
+           (uint32_t)((uint64_t)done * US_PER_SEC / elapsed));
+    printf("fast latency p50: %" PRIu32 " us, p99: %" PRIu32 " us\n", p50, p99);
+
+    /* with more than one worker, fast requests do not wait for slow ones */
+    if (WORKERS_NUMOF > 1) {
+        expect(p99 < SLOW_MS * US_PER_MS);
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
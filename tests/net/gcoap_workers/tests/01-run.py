@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"workers: (\d+)")
+    child.expect(r"requests: (\d+), rejected: (\d+), slow: (\d+)")
+    assert int(child.match.group(1)) > 0
+    assert int(child.match.group(3)) > 0
+    child.expect(r"requests/s: (\d+)")
+    child.expect(r"fast latency p50: (\d+) us, p99: (\d+) us")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -515,6 +515,91 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_many__EAGAIN(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[2] = {
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+}
+
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    uint8_t small[4];
+    sock_udp_msg_t msgs[4] = {
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) / 2 },
+        { .data = small, .max_len = sizeof(small) },
+        { .data = _test_buffer + sizeof(_test_buffer) / 2,
+          .max_len = sizeof(_test_buffer) / 2 },
+        { .data = NULL, .max_len = 0 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "IJKL", sizeof("IJKL"),
+                          _TEST_NETIF));
+    expect(3 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   _TEST_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(-ENOBUFS == msgs[1].len);
+    expect(sizeof("IJKL") == msgs[2].len);
+    expect(memcmp(msgs[2].data, "IJKL", sizeof("IJKL")) == 0);
+    for (unsigned i = 0; i < 3; i++) {
+        expect(AF_INET6 == msgs[i].remote.family);
+        expect(memcmp(&msgs[i].remote.addr, &src_addr, sizeof(src_addr)) == 0);
+        expect(_TEST_NETIF == msgs[i].remote.netif);
+    }
+    expect(_TEST_PORT_REMOTE == msgs[0].remote.port);
+    expect(_TEST_PORT_REMOTE + 1 == msgs[2].remote.port);
+    expect(_check_net());
+}
+
+static void test_sock_udp_set_queue(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    msg_t queue[2];
+    sock_udp_msg_t msgs[4] = {
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EINVAL == gnrc_sock_udp_set_queue(&_sock, queue, 3));
+    expect(0 == gnrc_sock_udp_set_queue(&_sock, queue, ARRAY_SIZE(queue)));
+    for (unsigned i = 0; i < ARRAY_SIZE(queue) + 1; i++) {
+        /* the last one is dropped by the stack */
+        expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                              _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                              _TEST_NETIF));
+    }
+    expect(-EBUSY == gnrc_sock_udp_set_queue(&_sock, queue, ARRAY_SIZE(queue)));
+    expect(ARRAY_SIZE(queue) == (unsigned)sock_udp_recv_many(&_sock, msgs,
+                                                            ARRAY_SIZE(msgs),
+                                                            0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -852,6 +937,9 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__EAGAIN());
+    CALL(test_sock_udp_recv_many__success());
+    CALL(test_sock_udp_set_queue());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
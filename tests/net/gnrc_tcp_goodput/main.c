@@ -0,0 +1,242 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer goodput of gnrc_tcp
+ *
+ * The shell commands `sink` and `source` receive respectively send a number
+ * of bytes over a single connection and report the goodput. The data follows
+ * a fixed pattern, so the receiving side can verify it. `source` also reports
+ * the initial sequence number and how the congestion window changed during
+ * the transfer. The command `loss`
+ * makes the network interface drop the given share of frames in both
+ * directions, to emulate a lossy link.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "random.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE     (8U)
+#define BUFFER_SIZE         (1024U)
+#define TIMEOUT_MS          (10U * MS_PER_SEC)
+
+/* the byte at stream offset n is n % PATTERN_MOD */
+#define PATTERN_MOD         (251U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _buf[BUFFER_SIZE];
+
+static const gnrc_netif_ops_t *_netif_ops;
+static gnrc_netif_ops_t _lossy_ops;
+static unsigned _loss;
+
+static bool _drop(void)
+{
+    return random_uint32_range(0, 100) < _loss;
+}
+
+static int _lossy_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    /* only legacy drivers release the packet in send() themselves */
+    if (gnrc_netif_netdev_legacy_api(netif) && _drop()) {
+        int len = gnrc_pkt_len(pkt);
+
+        gnrc_pktbuf_release(pkt);
+        return len;
+    }
+    return _netif_ops->send(netif, pkt);
+}
+
+static gnrc_pktsnip_t *_lossy_recv(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkt = _netif_ops->recv(netif);
+
+    if ((pkt != NULL) && _drop()) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    return pkt;
+}
+
+static int _loss_cmd(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <percent>\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+
+    if (_netif_ops == NULL) {
+        _netif_ops = netif->ops;
+        _lossy_ops = *_netif_ops;
+        _lossy_ops.send = _lossy_send;
+        _lossy_ops.recv = _lossy_recv;
+        netif->ops = &_lossy_ops;
+    }
+    _loss = atoi(argv[1]);
+    printf("loss: %u%%\n", _loss);
+    return 0;
+}
+
+static void _report(const char *cmd, uint32_t bytes, uint32_t start, bool ok)
+{
+    uint32_t elapsed = ztimer_now(ZTIMER_MSEC) - start;
+
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " ms, goodput %" PRIu32 " B/s, %s\n",
+           cmd, bytes, elapsed, (uint32_t)((uint64_t)bytes * MS_PER_SEC / elapsed),
+           ok ? "ok" : "corrupted");
+}
+
+static int _sink_cmd(int argc, char **argv)
+{
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t bytes = strtoul(argv[2], NULL, 10);
+    uint32_t rcvd = 0;
+    bool ok = true;
+
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_listen(&_queue, &_tcb, 1, &local);
+    if (res < 0) {
+        printf("%s: listen failed: %d\n", argv[0], res);
+        return 1;
+    }
+    puts("sink: listening");
+
+    res = gnrc_tcp_accept(&_queue, &tcb, TIMEOUT_MS);
+    if (res < 0) {
+        printf("%s: accept failed: %d\n", argv[0], res);
+        gnrc_tcp_stop_listen(&_queue);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    while (rcvd < bytes) {
+        ssize_t n = gnrc_tcp_recv(tcb, _buf, sizeof(_buf), TIMEOUT_MS);
+
+        if (n <= 0) {
+            printf("%s: recv failed: %d\n", argv[0], (int)n);
+            ok = false;
+            break;
+        }
+        for (ssize_t i = 0; i < n; i++) {
+            if (_buf[i] != (rcvd + i) % PATTERN_MOD) {
+                ok = false;
+            }
+        }
+        rcvd += n;
+    }
+    _report(argv[0], rcvd, start, ok);
+
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+    return ok ? 0 : 1;
+}
+
+static int _source_cmd(int argc, char **argv)
+{
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_tcp_ep_t remote;
+    uint32_t bytes = strtoul(argv[2], NULL, 10);
+    uint32_t sent = 0;
+    bool ok = true;
+
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: open failed: %d\n", argv[0], res);
+        return 1;
+    }
+    congure_wnd_size_t cwnd = _tcb.congure->cwnd;
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    while (sent < bytes) {
+        size_t len = bytes - sent;
+
+        if (len > sizeof(_buf)) {
+            len = sizeof(_buf);
+        }
+        for (size_t i = 0; i < len; i++) {
+            _buf[i] = (sent + i) % PATTERN_MOD;
+        }
+
+        /* send what is left of this chunk */
+        for (size_t off = 0; off < len;) {
+            ssize_t n = gnrc_tcp_send(&_tcb, _buf + off, len - off, TIMEOUT_MS);
+
+            if (n <= 0) {
+                printf("%s: send failed: %d\n", argv[0], (int)n);
+                ok = false;
+                break;
+            }
+            off += n;
+            sent += n;
+        }
+        if (!ok) {
+            break;
+        }
+    }
+    _report(argv[0], sent, start, ok);
+    /* an aborted connection already released its congestion control */
+    if (_tcb.congure != NULL) {
+        printf("%s: iss 0x%08" PRIx32 ", cwnd %u -> %u\n", argv[0], _tcb.iss,
+               (unsigned)cwnd, (unsigned)_tcb.congure->cwnd);
+    }
+    gnrc_tcp_close(&_tcb);
+    return ok ? 0 : 1;
+}
+
+static const shell_command_t _commands[] = {
+    { "sink", "receive bytes and report the goodput", _sink_cmd },
+    { "source", "send bytes and report the goodput", _source_cmd },
+    { "loss", "drop the given percentage of frames", _loss_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
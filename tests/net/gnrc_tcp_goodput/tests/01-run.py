@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import random
+import re
+import socket
+import subprocess
+import sys
+import threading
+
+from testrunner import run
+
+# Loss rates in percent, the node drops that share of frames in both directions
+LOSS = (0, 1, 5)
+BYTES = 256 * 1024
+PATTERN = bytes(i % 251 for i in range(BYTES))
+TIMEOUT = 120
+# Lossless transfers from the node until one starts with an initial sequence
+# number in the upper half of the sequence number space
+ISS_ATTEMPTS = 32
+
+
+def _set_loss(child, loss):
+    child.sendline('loss {}'.format(loss))
+    child.expect_exact('loss: {}%'.format(loss))
+
+
+def _host_addr(tap):
+    out = subprocess.check_output(['ip', 'addr', 'show', 'dev', tap, 'scope', 'link'])
+    return re.search(r'inet6 (\S+)/64', out.decode()).group(1)
+
+
+def _riot_iface(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)')
+    iface = child.match.group(1)
+    child.expect(r'inet6 addr: (fe80::[0-9a-f:]+)')
+    return iface, child.match.group(1)
+
+
+def _sink(child, tap, riot_addr):
+    port = random.randint(1024, 65535)
+    child.sendline('sink {} {}'.format(port, BYTES))
+    child.expect_exact('sink: listening')
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.connect((riot_addr, port, 0, socket.if_nametoindex(tap)))
+        sock.sendall(PATTERN)
+        child.expect(r'sink: (\d+) bytes in \d+ ms, goodput (\d+) B/s, ok',
+                     timeout=TIMEOUT)
+    assert int(child.match.group(1)) == BYTES
+    return int(child.match.group(2))
+
+
+def _source(child, tap, iface):
+    received = bytearray()
+
+    def _receive(listen_sock):
+        conn, _ = listen_sock.accept()
+        with conn:
+            while True:
+                data = conn.recv(65536)
+                if not data:
+                    break
+                received.extend(data)
+
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as listen_sock:
+        listen_sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        listen_sock.bind(('::', 0))
+        listen_sock.listen(1)
+        port = listen_sock.getsockname()[1]
+        thread = threading.Thread(target=_receive, args=(listen_sock,))
+        thread.start()
+        child.sendline('source [{}%{}]:{} {}'.format(_host_addr(tap), iface, port, BYTES))
+        child.expect(r'source: (\d+) bytes in \d+ ms, goodput (\d+) B/s, ok',
+                     timeout=TIMEOUT)
+        goodput = int(child.match.group(2))
+        child.expect(r'source: iss 0x([0-9a-f]{8}), cwnd (\d+) -> (\d+)')
+        iss = int(child.match.group(1), 16)
+        cwnd = (int(child.match.group(2)), int(child.match.group(3)))
+        thread.join(TIMEOUT)
+    assert received == PATTERN
+    return goodput, iss, cwnd
+
+
+def _high_iss(child, tap, iface):
+    _set_loss(child, 0)
+    for _ in range(ISS_ATTEMPTS):
+        _, iss, cwnd = _source(child, tap, iface)
+        # Without loss, every acknowledgment grows the congestion window
+        assert cwnd[1] > cwnd[0], 'cwnd did not grow with ISS 0x{:08x}'.format(iss)
+        if iss >= 0x80000000:
+            return
+    assert False, 'no ISS in the upper half of the sequence number space'
+
+
+def testfunc(child):
+    tap = os.environ['TAPDEV']
+    iface, riot_addr = _riot_iface(child)
+    results = []
+
+    for loss in LOSS:
+        _set_loss(child, loss)
+        results.append((loss, _sink(child, tap, riot_addr),
+                        _source(child, tap, iface)[0]))
+    _high_iss(child, tap, iface)
+
+    print('\nGoodput in B/s with {} bytes:'.format(BYTES))
+    print('| loss | host to node | node to host |')
+    for loss, sink, source in results:
+        print('| {:3d}% | {:12d} | {:12d} |'.format(loss, sink, source))
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=TIMEOUT))
@@ -49,6 +49,12 @@ def testfunc(child):
     assert(len(data) == (ZEP_DATA_HEADER_SIZE + len("Hello\0World\0") + FCS_LEN))
     assert(b"Hello\0World\0" == data[ZEP_DATA_HEADER_SIZE:-2])
     child.expect_exact("Waiting for an incoming message (use `make test`)")
+    # frame on another channel is dropped by the driver
+    s.sendto(b"\x45\x58\x02\x01\x0b\x44\xe0\x01\xff\xdb\xde\xa6\x1a\x00\x8b" +
+             b"\xfd\xae\x60\xd3\x21\xf1\x00\x00\x00\x00\x00\x00\x00\x00\x00" +
+             b"\x00\x22\x41\xdc\x02\x23\x00\x38\x30\x00\x0a\x50\x45\x5a\x00" +
+             b"\x5b\x45\x00\x0a\x50\x45\x5a\x00Other Chan\x3a\xf2",
+             ("127.0.0.1", zep_params['local_port']))
     s.sendto(b"\x45\x58\x02\x01\x1a\x44\xe0\x01\xff\xdb\xde\xa6\x1a\x00\x8b" +
              b"\xfd\xae\x60\xd3\x21\xf1\x00\x00\x00\x00\x00\x00\x00\x00\x00" +
              b"\x00\x22\x41\xdc\x02\x23\x00\x38\x30\x00\x0a\x50\x45\x5a\x00" +
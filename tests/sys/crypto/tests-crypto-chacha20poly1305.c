@@ -79,10 +79,45 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+static void test_crypto_chacha20poly1305_inplace_unaligned(void)
+{
+    const size_t msglen = sizeof(msg_1);
+    uint8_t *buf = ebuf + 1;
+    size_t len;
+
+    memcpy(buf, msg_1, msglen);
+    chacha20poly1305_encrypt(buf, buf, msglen, aad_1, sizeof(aad_1), key_1, nonce_1);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, ciphertext_1, msglen + 16));
+    TEST_ASSERT_EQUAL_INT(1,
+            chacha20poly1305_decrypt(buf, msglen + 16, buf, &len, aad_1, sizeof(aad_1),
+                                     key_1, nonce_1));
+    TEST_ASSERT_EQUAL_INT(msglen, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, msg_1, msglen));
+}
+
+static void test_crypto_chacha20poly1305_tampered(void)
+{
+    const size_t msglen = sizeof(msg_1);
+    size_t len;
+
+    memcpy(ebuf, ciphertext_1, msglen + 16);
+    ebuf[msglen / 2] ^= 0x01;
+    memset(pbuf, 0xff, msglen);
+    TEST_ASSERT_EQUAL_INT(0,
+            chacha20poly1305_decrypt(ebuf, msglen + 16, pbuf, &len, aad_1, sizeof(aad_1),
+                                     key_1, nonce_1));
+    /* no unauthenticated plaintext is left behind */
+    for (size_t i = 0; i < msglen; i++) {
+        TEST_ASSERT_EQUAL_INT(0, pbuf[i]);
+    }
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_inplace_unaligned),
+        new_TestFixture(test_crypto_chacha20poly1305_tampered),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include "embUnit.h"
+#include "crypto/aes.h"
 #include "crypto/ciphers.h"
 #include "tests-crypto.h"
 
@@ -57,6 +58,43 @@ static void test_crypto_cipher_aes_decrypt(void)
     TEST_ASSERT_MESSAGE(1 == cmp, "wrong plaintext");
 }
 
+/* AES without its multi-block operations, to exercise the generic fallback */
+static const cipher_interface_t aes_single_block = {
+    AES_BLOCK_SIZE, aes_init, aes_encrypt, aes_decrypt, NULL, NULL, NULL
+};
+
+static void test_crypto_cipher_aes_blocks(void)
+{
+    cipher_t bulk, single;
+    uint8_t plain[7 * 16], data[7 * 16], ref[7 * 16];
+    uint8_t ctr[16] = { 0 }, ctr_ref[16] = { 0 };
+
+    for (unsigned i = 0; i < sizeof(plain); i++) {
+        plain[i] = i * 7;
+    }
+    ctr[15] = 0xfe;
+    ctr_ref[15] = 0xfe;
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&bulk, CIPHER_AES, TEST_KEY, 16));
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&single, &aes_single_block, TEST_KEY, 16));
+
+    /* four blocks at once plus a tail, compared to the fallback */
+    TEST_ASSERT_EQUAL_INT(1, cipher_encrypt_blocks(&bulk, plain, data, 7));
+    TEST_ASSERT_EQUAL_INT(1, cipher_encrypt_blocks(&single, plain, ref, 7));
+    TEST_ASSERT(memcmp(data, ref, sizeof(data)) == 0);
+
+    /* in place */
+    TEST_ASSERT_EQUAL_INT(1, cipher_decrypt_blocks(&bulk, data, data, 7));
+    TEST_ASSERT(memcmp(data, plain, sizeof(data)) == 0);
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_ctr_blocks(&bulk, ctr, 2, plain, data, 7));
+    TEST_ASSERT_EQUAL_INT(1, cipher_ctr_blocks(&single, ctr_ref, 2, plain, ref, 7));
+    TEST_ASSERT(memcmp(data, ref, sizeof(data)) == 0);
+    TEST_ASSERT(memcmp(ctr, ctr_ref, sizeof(ctr)) == 0);
+    TEST_ASSERT_EQUAL_INT(0x01, ctr[14]);
+    TEST_ASSERT_EQUAL_INT(0x05, ctr[15]);
+}
+
 static void test_crypto_cipher_init_aes_key_length(void)
 {
     cipher_t cipher;
@@ -77,6 +115,7 @@ Test *tests_crypto_cipher_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_cipher_aes_encrypt),
         new_TestFixture(test_crypto_cipher_aes_decrypt),
+        new_TestFixture(test_crypto_cipher_aes_blocks),
         new_TestFixture(test_crypto_cipher_init_aes_key_length),
     };
 
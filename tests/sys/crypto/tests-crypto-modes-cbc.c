@@ -237,11 +237,39 @@ static void test_crypto_modes_cbc_decrypt(void)
                     TEST_CIPHER_LEN, TEST_PLAIN, TEST_PLAIN_LEN);
 }
 
+static void test_crypto_modes_cbc_inplace(void)
+{
+    cipher_t cipher;
+    uint8_t data[112], iv[16];
+    int len;
+
+    /* more blocks than are decrypted at once */
+    memcpy(data, TEST_PLAIN, 64);
+    memcpy(data + 64, TEST_PLAIN, 48);
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES, TEST_1_KEY,
+                                         TEST_1_KEY_LEN));
+
+    memcpy(iv, TEST_IV, 16);
+    len = cipher_encrypt_cbc(&cipher, iv, data, sizeof(data), data);
+    TEST_ASSERT_EQUAL_INT(sizeof(data), len);
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_1_CIPHER, data, TEST_CIPHER_LEN),
+                        "wrong ciphertext");
+
+    memcpy(iv, TEST_IV, 16);
+    len = cipher_decrypt_cbc(&cipher, iv, data, sizeof(data), data);
+    TEST_ASSERT_EQUAL_INT(sizeof(data), len);
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_PLAIN, data, 64), "wrong plaintext");
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_PLAIN, data + 64, 48),
+                        "wrong plaintext");
+}
+
 Test *tests_crypto_modes_cbc_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_cbc_encrypt),
-        new_TestFixture(test_crypto_modes_cbc_decrypt)
+        new_TestFixture(test_crypto_modes_cbc_decrypt),
+        new_TestFixture(test_crypto_modes_cbc_inplace)
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_cbc_tests, NULL, NULL, fixtures);
@@ -11,6 +11,7 @@
 
 #include "embUnit.h"
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 #include "tests-crypto.h"
 
@@ -243,11 +244,39 @@ static void test_crypto_modes_ctr_decrypt(void)
                     TEST_CIPHER_LEN, TEST_PLAIN, TEST_PLAIN_LEN);
 }
 
+static void test_crypto_modes_ctr_inplace_partial(void)
+{
+    cipher_t cipher;
+    uint8_t ctr[16], ctr_expected[16], data[64];
+    int len;
+
+    memcpy(ctr, TEST_COUNTER, 16);
+    memcpy(ctr_expected, TEST_COUNTER, 16);
+    memcpy(data, TEST_PLAIN, sizeof(data));
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES, TEST_1_KEY,
+                                         TEST_1_KEY_LEN));
+
+    /* two complete blocks and a partial one */
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, data, 37, data);
+    TEST_ASSERT_EQUAL_INT(37, len);
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_1_CIPHER, data, 37),
+                        "wrong ciphertext");
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_PLAIN + 37, data + 37, 64 - 37),
+                        "wrote past the end");
+
+    for (unsigned i = 0; i < 3; i++) {
+        crypto_block_inc_ctr(ctr_expected, 16);
+    }
+    TEST_ASSERT_MESSAGE(1 == compare(ctr_expected, ctr, 16), "wrong counter");
+}
+
 Test *tests_crypto_modes_ctr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ctr_encrypt),
-        new_TestFixture(test_crypto_modes_ctr_decrypt)
+        new_TestFixture(test_crypto_modes_ctr_decrypt),
+        new_TestFixture(test_crypto_modes_ctr_inplace_partial)
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ctr_tests, NULL, NULL, fixtures);
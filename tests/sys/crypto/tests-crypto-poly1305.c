@@ -7,6 +7,7 @@
 #include "embUnit/embUnit.h"
 #include "tests-crypto.h"
 
+#include "container.h"
 #include "crypto/poly1305.h"
 
 #include <string.h>
@@ -278,6 +279,28 @@ static void test_crypto_poly1305_11(void)
     _test_poly1305(key_11, msg_11, sizeof(msg_11), tag_11);
 }
 
+static void test_crypto_poly1305_split(void)
+{
+    /* chunk sizes exercising partial, full and unaligned blocks */
+    static const size_t chunks[] = { 1, 15, 17, 16, 3, 64, 13, 32 };
+    poly1305_ctx_t ctx;
+    uint8_t gen_tag[16];
+    size_t pos = 0;
+
+    poly1305_init(&ctx, key_2);
+    for (unsigned i = 0; pos < sizeof(msg_2); i++) {
+        size_t len = chunks[i % ARRAY_SIZE(chunks)];
+
+        if (len > sizeof(msg_2) - pos) {
+            len = sizeof(msg_2) - pos;
+        }
+        poly1305_update(&ctx, &msg_2[pos], len);
+        pos += len;
+    }
+    poly1305_finish(&ctx, gen_tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(gen_tag, tag_2, sizeof(gen_tag)));
+}
+
 Test *tests_crypto_poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -292,6 +315,7 @@ Test *tests_crypto_poly1305_tests(void)
         new_TestFixture(test_crypto_poly1305_9),
         new_TestFixture(test_crypto_poly1305_10),
         new_TestFixture(test_crypto_poly1305_11),
+        new_TestFixture(test_crypto_poly1305_split),
     };
     EMB_UNIT_TESTCALLER(crypto_poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_poly1305_tests;
@@ -84,6 +84,13 @@ struct testcase testcases[] = {
             0x70, 0x92, 0x28, 0x0e, 0x1d, 0x1a, 0x00, 0xb6,
         }
     },
+    {
+        .password = "passwd",
+        .salt = "salt",
+        .iterations = 0,
+        /* no iteration, the output is only cleared */
+        .digest = { 0 },
+    },
 };
 
 int main(void)
@@ -93,7 +100,8 @@ int main(void)
         struct testcase *tc = &testcases[i];
         size_t password_len = strlen(tc->password);
         size_t salt_len = strlen(tc->salt);
-        memset(key, 0x00, sizeof(key));
+        /* not the expected output of any test vector */
+        memset(key, 0xff, sizeof(key));
         pbkdf2_sha256(tc->password, password_len, tc->salt, salt_len,
                       tc->iterations, key);
 
@@ -0,0 +1,324 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test the key ID index and the eviction of persistent keys of
+ *              the PSA Crypto key slot management
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "psa/crypto.h"
+#include "psa_crypto_slot_management.h"
+
+#define TEST_ASSERT_PSA_SUCCESS(func_)  TEST_ASSERT_MESSAGE((func_) == PSA_SUCCESS, \
+                                                            #func_ " failed")
+
+/* Same size and hash as the key ID index of the slot management */
+#define KEY_INDEX_SIZE      (2 * PSA_KEY_SLOT_COUNT + 1)
+
+/* Volatile keys imported at most to find one with a given index position */
+#define IMPORT_ATTEMPTS     (16 * KEY_INDEX_SIZE)
+
+#define HMAC_KEY_LEN        (32U)
+
+#define ECC_KEY_SIZE        (255)
+#define ECC_KEY_TYPE        (PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_TWISTED_EDWARDS))
+#define ECC_ALG             (PSA_ALG_PURE_EDDSA)
+
+static const uint8_t _hmac_key[HMAC_KEY_LEN] = { 0x52, 0x49, 0x4f, 0x54 };
+
+static unsigned _home(psa_key_id_t id)
+{
+    uint32_t h = id * 0x9e3779b1;
+
+    return (h ^ (h >> 16)) % KEY_INDEX_SIZE;
+}
+
+static psa_key_attributes_t _hmac_attr(psa_key_id_t id)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+
+    psa_set_key_algorithm(&attr, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_SIGN_MESSAGE);
+    psa_set_key_bits(&attr, PSA_BYTES_TO_BITS(HMAC_KEY_LEN));
+    psa_set_key_type(&attr, PSA_KEY_TYPE_HMAC);
+    if (id != PSA_KEY_ID_NULL) {
+        psa_set_key_id(&attr, id);
+        psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_PERSISTENT);
+    }
+    return attr;
+}
+
+static int _exists(psa_key_id_t id)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+
+    return psa_get_key_attributes(id, &attr) == PSA_SUCCESS;
+}
+
+/* Imports volatile keys until one has the given home position in the index.
+ * The others are destroyed right away. */
+static psa_key_id_t _import_with_home(unsigned home)
+{
+    psa_key_attributes_t attr = _hmac_attr(PSA_KEY_ID_NULL);
+
+    for (unsigned i = 0; i < IMPORT_ATTEMPTS; i++) {
+        psa_key_id_t id;
+
+        if (psa_import_key(&attr, _hmac_key, sizeof(_hmac_key), &id) != PSA_SUCCESS) {
+            return PSA_KEY_ID_NULL;
+        }
+        if (_home(id) == home) {
+            return id;
+        }
+        psa_destroy_key(id);
+    }
+    return PSA_KEY_ID_NULL;
+}
+
+static void _teardown(void)
+{
+    psa_wipe_all_key_slots();
+}
+
+/* Deletes the middle entry of a probe chain, the last one has to move up */
+static void _probe_chain(unsigned home)
+{
+    psa_key_id_t first = _import_with_home(home);
+    psa_key_id_t middle = _import_with_home(home);
+    psa_key_id_t last = _import_with_home(home);
+
+    TEST_ASSERT(first != PSA_KEY_ID_NULL);
+    TEST_ASSERT(middle != PSA_KEY_ID_NULL);
+    TEST_ASSERT(last != PSA_KEY_ID_NULL);
+
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(middle));
+    TEST_ASSERT(_exists(first));
+    TEST_ASSERT(!_exists(middle));
+    TEST_ASSERT(_exists(last));
+
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(first));
+    TEST_ASSERT(_exists(last));
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(last));
+}
+
+static void test_key_index_probe_chain(void)
+{
+    _probe_chain(1);
+}
+
+static void test_key_index_probe_chain_wrap_around(void)
+{
+    /* the chain occupies the last two entries and the first one */
+    _probe_chain(KEY_INDEX_SIZE - 2);
+}
+
+/* An entry behind the gap whose probe sequence starts after the gap stays */
+static void test_key_index_keep_entry_after_gap(void)
+{
+    psa_key_id_t first = _import_with_home(3);
+    psa_key_id_t second = _import_with_home(3);
+    psa_key_id_t moved = _import_with_home(4);
+    psa_key_id_t kept;
+
+    TEST_ASSERT(first != PSA_KEY_ID_NULL);
+    TEST_ASSERT(second != PSA_KEY_ID_NULL);
+    TEST_ASSERT(moved != PSA_KEY_ID_NULL);
+
+    /* first, second and moved occupy 3, 4 and 5 */
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(first));
+    TEST_ASSERT(_exists(second));
+    TEST_ASSERT(_exists(moved));
+
+    /* second and moved occupy 3 and 4 now, kept goes to its home 5 */
+    kept = _import_with_home(5);
+    TEST_ASSERT(kept != PSA_KEY_ID_NULL);
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(second));
+    TEST_ASSERT(_exists(moved));
+    TEST_ASSERT(_exists(kept));
+
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(moved));
+    TEST_ASSERT_PSA_SUCCESS(psa_destroy_key(kept));
+}
+
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+/* IDs of the persistent keys, the first PSA_SINGLE_KEY_COUNT fill all slots */
+#define KEY_PAIR_ID         (PSA_SINGLE_KEY_COUNT + 3)
+
+static psa_key_slot_t *_slot(psa_key_id_t id)
+{
+    psa_key_slot_t *slot = NULL;
+
+    if (psa_get_and_lock_key_slot(id, &slot) != PSA_SUCCESS) {
+        return NULL;
+    }
+    psa_unlock_key_slot(slot);
+    return slot;
+}
+
+static psa_key_id_t _import_persistent(psa_key_id_t id)
+{
+    psa_key_attributes_t attr = _hmac_attr(id);
+
+    if (psa_import_key(&attr, _hmac_key, sizeof(_hmac_key), &id) != PSA_SUCCESS) {
+        return PSA_KEY_ID_NULL;
+    }
+    return id;
+}
+
+/* Imports persistent keys 1 to @p num and uses them in this order */
+static int _fill(psa_key_slot_t **slots, unsigned num)
+{
+    for (unsigned i = 1; i <= num; i++) {
+        if (_import_persistent(i) != i) {
+            return -1;
+        }
+    }
+    for (unsigned i = 1; i <= num; i++) {
+        slots[i] = _slot(i);
+        if (slots[i] == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _teardown_persistent(void)
+{
+    /* evicted keys are loaded again to destroy them */
+    for (psa_key_id_t id = 1; id <= KEY_PAIR_ID; id++) {
+        psa_destroy_key(id);
+    }
+    psa_wipe_all_key_slots();
+}
+
+static void test_evict_least_recently_used(void)
+{
+    psa_key_slot_t *slots[PSA_SINGLE_KEY_COUNT + 1];
+
+    TEST_ASSERT(_fill(slots, PSA_SINGLE_KEY_COUNT) == 0);
+
+    /* key 2 was used least recently now */
+    TEST_ASSERT(_slot(1) == slots[1]);
+    TEST_ASSERT(_import_persistent(PSA_SINGLE_KEY_COUNT + 1) == PSA_SINGLE_KEY_COUNT + 1);
+    TEST_ASSERT_EQUAL_INT(1, slots[1]->attr.id);
+    TEST_ASSERT_EQUAL_INT(PSA_SINGLE_KEY_COUNT + 1, slots[2]->attr.id);
+    TEST_ASSERT_EQUAL_INT(3, slots[3]->attr.id);
+
+    /* followed by key 3 */
+    TEST_ASSERT(_import_persistent(PSA_SINGLE_KEY_COUNT + 2) == PSA_SINGLE_KEY_COUNT + 2);
+    TEST_ASSERT_EQUAL_INT(1, slots[1]->attr.id);
+    TEST_ASSERT_EQUAL_INT(PSA_SINGLE_KEY_COUNT + 1, slots[2]->attr.id);
+    TEST_ASSERT_EQUAL_INT(PSA_SINGLE_KEY_COUNT + 2, slots[3]->attr.id);
+}
+
+static void test_evict_skips_locked(void)
+{
+    psa_key_slot_t *slots[PSA_SINGLE_KEY_COUNT + 1];
+    psa_key_slot_t *locked;
+
+    TEST_ASSERT(_fill(slots, PSA_SINGLE_KEY_COUNT) == 0);
+
+    /* key 1 is the least recently used one, but in use */
+    TEST_ASSERT_PSA_SUCCESS(psa_get_and_lock_key_slot(1, &locked));
+    for (unsigned i = 2; i <= PSA_SINGLE_KEY_COUNT; i++) {
+        TEST_ASSERT(_slot(i) == slots[i]);
+    }
+    TEST_ASSERT(_import_persistent(PSA_SINGLE_KEY_COUNT + 1) == PSA_SINGLE_KEY_COUNT + 1);
+    TEST_ASSERT_EQUAL_INT(1, slots[1]->attr.id);
+    TEST_ASSERT_EQUAL_INT(PSA_SINGLE_KEY_COUNT + 1, slots[2]->attr.id);
+
+    /* no slot can be freed while all keys are in use */
+    for (unsigned i = 2; i <= PSA_SINGLE_KEY_COUNT; i++) {
+        TEST_ASSERT_PSA_SUCCESS(psa_get_and_lock_key_slot(slots[i]->attr.id, &locked));
+    }
+    TEST_ASSERT(_import_persistent(PSA_SINGLE_KEY_COUNT + 2) == PSA_KEY_ID_NULL);
+    for (unsigned i = 1; i <= PSA_SINGLE_KEY_COUNT; i++) {
+        TEST_ASSERT_PSA_SUCCESS(psa_unlock_key_slot(slots[i]));
+    }
+}
+
+static void test_evict_persistent_of_same_type(void)
+{
+    psa_key_slot_t *slots[PSA_SINGLE_KEY_COUNT + 1];
+    psa_key_attributes_t attr = psa_key_attributes_init();
+    psa_key_id_t key_pair = KEY_PAIR_ID;
+    psa_key_id_t volatile_key;
+    psa_key_slot_t *slot_pair, *slot_volatile;
+
+    psa_set_key_algorithm(&attr, ECC_ALG);
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_SIGN_MESSAGE);
+    psa_set_key_type(&attr, ECC_KEY_TYPE);
+    psa_set_key_bits(&attr, ECC_KEY_SIZE);
+    psa_set_key_id(&attr, key_pair);
+    psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_PERSISTENT);
+    TEST_ASSERT_PSA_SUCCESS(psa_generate_key(&attr, &key_pair));
+    slot_pair = _slot(key_pair);
+    TEST_ASSERT_NOT_NULL(slot_pair);
+
+    attr = _hmac_attr(PSA_KEY_ID_NULL);
+    TEST_ASSERT_PSA_SUCCESS(psa_import_key(&attr, _hmac_key, sizeof(_hmac_key),
+                                           &volatile_key));
+    slot_volatile = _slot(volatile_key);
+    TEST_ASSERT_NOT_NULL(slot_volatile);
+
+    TEST_ASSERT(_fill(slots, PSA_SINGLE_KEY_COUNT - 1) == 0);
+
+    /* the key pair and the volatile key were used less recently than key 1,
+     * but only a persistent key of the same slot type can be evicted */
+    TEST_ASSERT(_import_persistent(PSA_SINGLE_KEY_COUNT) == PSA_SINGLE_KEY_COUNT);
+    TEST_ASSERT_EQUAL_INT(key_pair, slot_pair->attr.id);
+    TEST_ASSERT_EQUAL_INT(volatile_key, slot_volatile->attr.id);
+    TEST_ASSERT_EQUAL_INT(PSA_SINGLE_KEY_COUNT, slots[1]->attr.id);
+    TEST_ASSERT_EQUAL_INT(2, slots[2]->attr.id);
+}
+#endif /* MODULE_PSA_PERSISTENT_STORAGE */
+
+static Test *tests_psa_key_index(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_key_index_probe_chain),
+        new_TestFixture(test_key_index_probe_chain_wrap_around),
+        new_TestFixture(test_key_index_keep_entry_after_gap),
+    };
+
+    EMB_UNIT_TESTCALLER(tests_psa_key_index_tests, NULL, _teardown, fixtures);
+
+    return (Test *)&tests_psa_key_index_tests;
+}
+
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+static Test *tests_psa_key_eviction(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_evict_least_recently_used),
+        new_TestFixture(test_evict_skips_locked),
+        new_TestFixture(test_evict_persistent_of_same_type),
+    };
+
+    EMB_UNIT_TESTCALLER(tests_psa_key_eviction_tests, NULL, _teardown_persistent, fixtures);
+
+    return (Test *)&tests_psa_key_eviction_tests;
+}
+#endif /* MODULE_PSA_PERSISTENT_STORAGE */
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_psa_key_index());
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+    TESTS_RUN(tests_psa_key_eviction());
+#endif
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test SHA-256 verification of images written with
+ *              riotboot_flashwrite
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+#include "ztimer.h"
+
+#define IMG_SIZE        (100000U)
+#define CHUNK_SIZE      (100U)
+#define TARGET_SLOT     (1)
+
+static uint8_t _img[IMG_SIZE];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+static riotboot_flashwrite_t _writer;
+
+static int _write(bool raw)
+{
+    /* riotboot_flashwrite_init() skips the magic number */
+    size_t pos = RIOTBOOT_FLASHWRITE_SKIPLEN;
+    int res;
+
+    if (raw) {
+        res = riotboot_flashwrite_init_raw(&_writer, TARGET_SLOT, pos);
+    }
+    else {
+        res = riotboot_flashwrite_init(&_writer, TARGET_SLOT);
+    }
+    if (res < 0) {
+        return -1;
+    }
+    while (pos < IMG_SIZE) {
+        size_t len = (IMG_SIZE - pos < CHUNK_SIZE) ? IMG_SIZE - pos : CHUNK_SIZE;
+
+        if (riotboot_flashwrite_putbytes(&_writer, &_img[pos], len,
+                                         pos + len < IMG_SIZE) < 0) {
+            return -1;
+        }
+        pos += len;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    uint32_t start;
+    uint8_t wrong[SHA256_DIGEST_LENGTH];
+
+    memcpy(_img, "RIOT", 4);
+    for (unsigned i = 4; i < IMG_SIZE; i++) {
+        _img[i] = (i * 7919) >> 3;
+    }
+    sha256(_img, IMG_SIZE, _digest);
+    memcpy(wrong, _digest, sizeof(wrong));
+    wrong[5] ^= 0x10;
+
+    ztimer_acquire(ZTIMER_USEC);
+
+    start = ztimer_now(ZTIMER_USEC);
+    if (_write(false) < 0) {
+        puts("write failed");
+        return 1;
+    }
+    printf("write: %" PRIu32 " us\n", ztimer_now(ZTIMER_USEC) - start);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    start = ztimer_now(ZTIMER_USEC);
+    int res = riotboot_flashwrite_verify_sha256_state(&_writer, _digest, IMG_SIZE);
+    printf("verify (streamed): %" PRIu32 " us\n", ztimer_now(ZTIMER_USEC) - start);
+    if (res != 0) {
+        puts("streamed digest mismatch");
+        return 1;
+    }
+    if (riotboot_flashwrite_verify_sha256_state(&_writer, wrong, IMG_SIZE) != 1) {
+        puts("wrong digest accepted");
+        return 1;
+    }
+    if (riotboot_flashwrite_verify_sha256_state(&_writer, _digest, IMG_SIZE + 1) != 1) {
+        puts("wrong size accepted");
+        return 1;
+    }
+#endif
+
+    /* the first block is only written by riotboot_flashwrite_finish() */
+    if (riotboot_flashwrite_finish(&_writer) < 0) {
+        puts("finish failed");
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    if (riotboot_flashwrite_verify_sha256(_digest, IMG_SIZE, TARGET_SLOT) != 0) {
+        puts("read back digest mismatch");
+        return 1;
+    }
+    printf("verify (read back): %" PRIu32 " us\n", ztimer_now(ZTIMER_USEC) - start);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    /* with the same offset, riotboot_flashwrite_init_raw() hashes only the
+     * bytes passed to riotboot_flashwrite_putbytes() */
+    sha256(&_img[RIOTBOOT_FLASHWRITE_SKIPLEN], IMG_SIZE - RIOTBOOT_FLASHWRITE_SKIPLEN,
+           _digest);
+    if (_write(true) < 0) {
+        puts("write failed");
+        return 1;
+    }
+    if (riotboot_flashwrite_verify_sha256_state(&_writer, _digest, IMG_SIZE) != 0) {
+        puts("raw digest mismatch");
+        return 1;
+    }
+#endif
+
+    ztimer_release(ZTIMER_USEC);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
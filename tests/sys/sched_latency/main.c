@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the scheduler latency histogram
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "sched_latency.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define WAKEUPS         (100U)
+#define FLAG_WAKEUP     (0x0001)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static unsigned _woken;
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_flags_wait_any(FLAG_WAKEUP);
+        _woken++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    const uint8_t prio = THREAD_PRIORITY_MAIN - 1;
+    sched_latency_stats_t stats;
+    uint32_t sum = 0;
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), prio, 0,
+                                     _waiter, NULL, "waiter");
+    thread_t *waiter = thread_get(pid);
+
+    /* waiter runs right away and blocks on its flags */
+    sched_latency_reset();
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        /* preempts main and wakes up the waiter */
+        thread_flags_set(waiter, FLAG_WAKEUP);
+    }
+    expect(_woken == WAKEUPS);
+
+    sched_latency_get(prio, &stats);
+    for (unsigned i = 0; i < CONFIG_SCHED_LATENCY_BUCKETS; i++) {
+        sum += stats.hist[i];
+        if (stats.hist[i]) {
+            expect((i == 0) || (stats.max_us >= sched_latency_bucket_limit(i - 1)));
+        }
+    }
+    printf("waiter: %" PRIu32 " wakeups, max %" PRIu32 " us\n",
+           stats.wakeups, stats.max_us);
+    expect(stats.wakeups == WAKEUPS);
+    expect(sum == WAKEUPS);
+
+    sched_latency_get(THREAD_PRIORITY_MAIN, &stats);
+    printf("main: %" PRIu32 " preemptions\n", stats.preemptions);
+    expect(stats.preemptions >= WAKEUPS);
+
+    puts("\nScheduler latency:");
+    sched_latency_print();
+
+    puts("[SUCCESS]");
+    return 0;
+}
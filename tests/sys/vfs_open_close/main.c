@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Open/close throughput benchmark of the VFS layer
+ *
+ * Several constfs instances are mounted to mimic a device with multiple
+ * storages. As constfs does no I/O, the numbers mostly reflect the cost of
+ * resolving the mount point and allocating the file descriptor.
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "benchmark.h"
+#include "fs/constfs.h"
+#include "test_utils/expect.h"
+#include "vfs.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS      (100000UL)
+#endif
+
+/* number of files kept open during the second round */
+#define NUMOF_KEEP_OPEN (VFS_MAX_OPEN_FILES - 4)
+
+static const char _data[] = "log line\n";
+
+static const constfs_file_t _files[] = {
+    {
+        .path = "/log.txt",
+        .data = (const uint8_t *)_data,
+        .size = sizeof(_data) - 1,
+    },
+};
+
+static const constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+#define MOUNT(path) {                   \
+        .mount_point = path,            \
+        .fs = &constfs_file_system,     \
+        .private_data = (void *)&_fs,   \
+    }
+
+static vfs_mount_t _mounts[] = {
+    MOUNT("/"),
+    MOUNT("/const"),
+    MOUNT("/nvm0"),
+    MOUNT("/sd0"),
+    MOUNT("/sd0/log"),
+    MOUNT("/mnt/usb0"),
+};
+
+static void _open_close(const char *path)
+{
+    int fd = vfs_open(path, O_RDONLY, 0);
+
+    expect(fd >= 0);
+    vfs_close(fd);
+}
+
+static void _stat(const char *path)
+{
+    struct stat st;
+
+    expect(vfs_stat(path, &st) == 0);
+}
+
+static void _bench(void)
+{
+    BENCHMARK_FUNC("open/close /log.txt", BENCH_RUNS, _open_close("/log.txt"));
+    BENCHMARK_FUNC("open/close /nvm0/log.txt", BENCH_RUNS,
+                   _open_close("/nvm0/log.txt"));
+    BENCHMARK_FUNC("open/close /sd0/log/log.txt", BENCH_RUNS,
+                   _open_close("/sd0/log/log.txt"));
+    BENCHMARK_FUNC("stat /mnt/usb0/log.txt", BENCH_RUNS,
+                   _stat("/mnt/usb0/log.txt"));
+}
+
+int main(void)
+{
+    int fds[NUMOF_KEEP_OPEN];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_mounts); i++) {
+        expect(vfs_mount(&_mounts[i]) == 0);
+    }
+
+    printf("%u mounts, %u fds\n", (unsigned)ARRAY_SIZE(_mounts),
+           (unsigned)VFS_MAX_OPEN_FILES);
+    puts("\nempty fd table:");
+    _bench();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(fds); i++) {
+        fds[i] = vfs_open("/const/log.txt", O_RDONLY, 0);
+        expect(fds[i] >= 0);
+    }
+    printf("\n%u files open:\n", (unsigned)ARRAY_SIZE(fds));
+    _bench();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(fds); i++) {
+        vfs_close(fds[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -53,6 +53,20 @@ static void test_checksum_crc32_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
 }
 
+static void test_checksum_crc32_sequence_unaligned(void)
+{
+    /* odd start address and length that is neither a multiple of the slice
+     * nor of the folding width */
+    unsigned char buf[200];
+    uint32_t expect = 0xf0cdf417;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7 + 3;
+    }
+
+    TEST_ASSERT_EQUAL_INT(expect, crc32(buf + 1, sizeof(buf) - 1));
+}
+
 Test *tests_checksum_crc32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -61,6 +75,7 @@ Test *tests_checksum_crc32_tests(void)
         new_TestFixture(test_checksum_crc32_sequence_256a),
         new_TestFixture(test_checksum_crc32_sequence_1to9),
         new_TestFixture(test_checksum_crc32_sequence_4bytes),
+        new_TestFixture(test_checksum_crc32_sequence_unaligned),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
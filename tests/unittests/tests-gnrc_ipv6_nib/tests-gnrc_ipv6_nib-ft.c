@@ -175,6 +175,68 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds a route and then a route with a longer prefix both matching the
+ * destination.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns route with the longer prefix
+ * even though it was added last.
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN - 16,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 64,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+}
+
+/*
+ * Adds a route for each prefix length from 8 to 128 in steps of 8 in
+ * interleaved order and removes them again from longest to shortest.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest remaining prefix
+ */
+static void test_nib_ft_get__success_nested(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t other = dst;
+
+    for (unsigned i = 0; i < 16; i++) {
+        /* 8, 128, 16, 120, ... */
+        unsigned len = (i & 1) ? (128 - ((i / 2) * 8)) : (8 + ((i / 2) * 8));
+
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, len, &next_hop,
+                                                      IFACE, 0));
+    }
+    /* route that branches off in the first bit after the first prefix */
+    bf_toggle(other.u8, 8);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&other, 16, &next_hop,
+                                                  IFACE, 0));
+    for (unsigned len = 128; len > 0; len -= 8) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(len, fte.dst_len);
+        gnrc_ipv6_nib_ft_del(&dst, len);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(16, fte.dst_len);
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -724,6 +786,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
+        new_TestFixture(test_nib_ft_get__success_nested),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
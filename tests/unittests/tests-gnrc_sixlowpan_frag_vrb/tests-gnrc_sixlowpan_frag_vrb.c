@@ -140,6 +140,32 @@ static void test_vrb_get__after_add(void)
     TEST_ASSERT(res1 == res2);
 }
 
+static void test_vrb_get__many(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *entries[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        /* vary both tag and source */
+        base.tag = TEST_TAG + (i / 2);
+        base.src[TEST_SRC_LEN - 1] = i % 2;
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_vrb_add(
+                &base, &_dummy_netif, _out_dst, sizeof(_out_dst))));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        base.tag = TEST_TAG + (i / 2);
+        base.src[TEST_SRC_LEN - 1] = i % 2;
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_vrb_get(base.src,
+                                                              base.src_len,
+                                                              base.tag));
+    }
+    /* same tag, unknown source */
+    base.tag = TEST_TAG;
+    base.src[TEST_SRC_LEN - 1] = 2;
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                 base.tag));
+}
+
 static void test_vrb_rm(void)
 {
     gnrc_sixlowpan_frag_vrb_t *res;
@@ -153,6 +179,35 @@ static void test_vrb_rm(void)
                                                  _base.tag));
 }
 
+static void test_vrb_rm__churn(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *entries[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+    unsigned tags[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        base.tag = tags[i] = TEST_TAG + i;
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_vrb_add(
+                &base, &_dummy_netif, _out_dst, sizeof(_out_dst))));
+    }
+    /* replace entries round-robin, so removed entries leave stale index
+     * slots behind many times over */
+    for (unsigned n = 0; n < 8 * CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; n++) {
+        unsigned i = n % CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE;
+
+        gnrc_sixlowpan_frag_vrb_rm(entries[i]);
+        TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                     tags[i]));
+        base.tag = tags[i] = TEST_TAG + CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE + n;
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_vrb_add(
+                &base, &_dummy_netif, _out_dst, sizeof(_out_dst))));
+        for (unsigned j = 0; j < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; j++) {
+            TEST_ASSERT(entries[j] == gnrc_sixlowpan_frag_vrb_get(
+                    base.src, base.src_len, tags[j]));
+        }
+    }
+}
+
 static void test_vrb_gc(void)
 {
     gnrc_sixlowpan_frag_rb_base_t base = _base;
@@ -176,7 +231,9 @@ static Test *tests_gnrc_sixlowpan_frag_vrb_tests(void)
         new_TestFixture(test_vrb_add__full),
         new_TestFixture(test_vrb_get__empty),
         new_TestFixture(test_vrb_get__after_add),
+        new_TestFixture(test_vrb_get__many),
         new_TestFixture(test_vrb_rm),
+        new_TestFixture(test_vrb_rm__churn),
         new_TestFixture(test_vrb_gc),
     };
 
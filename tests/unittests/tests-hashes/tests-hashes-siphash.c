@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     unittests
+ * @{
+ *
+ * @file
+ * @brief       Test cases for the SipHash-2-4 implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "embUnit/embUnit.h"
+#include "container.h"
+#include "macros/utils.h"
+
+#include "hashes/siphash.h"
+
+#include "tests-hashes.h"
+
+static const uint8_t _key[SIPHASH_KEY_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+/* test vectors of the reference implementation: the key is 00..0f, the
+ * message of length n is 00..n-1 */
+static const struct {
+    uint8_t len;
+    uint64_t digest;
+} _vectors[] = {
+    {  0, 0x726fdb47dd0e0e31ULL },
+    {  1, 0x74f839c593dc67fdULL },
+    {  7, 0xab0200f58b01d137ULL },
+    {  8, 0x93f5f5799a932462ULL },
+    { 15, 0xa129ca6149be45e5ULL },
+    { 63, 0x958a324ceb064572ULL },
+};
+
+static uint8_t _msg[64];
+
+static void _init_msg(void)
+{
+    for (unsigned i = 0; i < sizeof(_msg); i++) {
+        _msg[i] = i;
+    }
+}
+
+static void test_hashes_siphash(void)
+{
+    _init_msg();
+    for (unsigned i = 0; i < ARRAY_SIZE(_vectors); i++) {
+        TEST_ASSERT(siphash(_key, _msg, _vectors[i].len) == _vectors[i].digest);
+    }
+}
+
+static void test_hashes_siphash_update(void)
+{
+    _init_msg();
+    for (unsigned i = 0; i < ARRAY_SIZE(_vectors); i++) {
+        /* feed the message in chunks of growing size */
+        siphash_context_t ctx;
+        unsigned pos = 0;
+
+        siphash_init(&ctx, _key);
+        for (unsigned chunk = 1; pos < _vectors[i].len; chunk++) {
+            unsigned len = MIN(chunk, _vectors[i].len - pos);
+
+            siphash_update(&ctx, &_msg[pos], len);
+            pos += len;
+        }
+        TEST_ASSERT(siphash_final(&ctx) == _vectors[i].digest);
+    }
+}
+
+Test *tests_hashes_siphash_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashes_siphash),
+        new_TestFixture(test_hashes_siphash_update),
+    };
+
+    EMB_UNIT_TESTCALLER(test_hashes_siphash, NULL, NULL, fixtures);
+
+    return (Test *)&test_hashes_siphash;
+}
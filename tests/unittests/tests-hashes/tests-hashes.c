@@ -31,4 +31,5 @@ void tests_hashes(void)
     TESTS_RUN(tests_hashes_sha512_224_tests());
     TESTS_RUN(tests_hashes_sha512_256_tests());
     TESTS_RUN(tests_hashes_sha3_tests());
+    TESTS_RUN(tests_hashes_siphash_tests());
 }
@@ -64,10 +64,17 @@ static void test_nanocoap_cache__cachekey(void)
 
     nanocoap_cache_key_generate((const coap_pkt_t *) &pkt2, digest2);
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+    /* the order depends on the random SipHash key */
+    ssize_t cmp = nanocoap_cache_key_compare(digest1, digest2);
+    TEST_ASSERT(cmp != 0);
+    TEST_ASSERT((cmp < 0) == (nanocoap_cache_key_compare(digest2, digest1) > 0));
+#else
     /* compare 1. and 3. packet */
     TEST_ASSERT(nanocoap_cache_key_compare(digest1, digest2) < 0);
     /* compare 3. and 1. packet */
     TEST_ASSERT(nanocoap_cache_key_compare(digest2, digest1) > 0);
+#endif
 }
 
 static void test_nanocoap_cache__cachekey_blockwise(void)
@@ -305,6 +312,110 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+static nanocoap_cache_entry_t *_add(const char *path, uint32_t max_age,
+                                     const char *etag)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t req, resp;
+    uint8_t token[2] = {0xDA, 0xEC};
+    size_t len;
+
+    len = coap_build_udp_hdr(buf, sizeof(buf), COAP_TYPE_NON,
+                             &token[0], 2, COAP_METHOD_GET, 0xABCD);
+    coap_pkt_init(&req, &buf[0], sizeof(buf), len);
+    coap_opt_add_string(&req, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_finish(&req, COAP_OPT_FINISH_NONE);
+
+    len = coap_build_udp_hdr(rbuf, sizeof(rbuf), COAP_TYPE_NON,
+                             &token[0], 2, COAP_CODE_205, 0xABCD);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), len);
+    if (etag) {
+        coap_opt_add_opaque(&resp, COAP_OPT_ETAG, etag, strlen(etag));
+    }
+    coap_opt_add_uint(&resp, COAP_OPT_MAX_AGE, max_age);
+    len = coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    return nanocoap_cache_add_by_req(&req, &resp, len);
+}
+
+static void test_nanocoap_cache__stats(void)
+{
+    nanocoap_cache_stats_t stats;
+    uint8_t key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    char path[16];
+
+    nanocoap_cache_init();
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES + 2; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        nanocoap_cache_entry_t *c = _add(path, 60, NULL);
+        TEST_ASSERT_NOT_NULL(c);
+        if (i == 0) {
+            memcpy(key, c->cache_key, sizeof(key));
+        }
+    }
+    /* first one was replaced */
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(key));
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(2, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(0, stats.expirations);
+
+    /* all others are found */
+    for (unsigned i = 2; i < CONFIG_NANOCOAP_CACHE_ENTRIES + 2; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        nanocoap_cache_entry_t *c = _add(path, 60, NULL);
+        TEST_ASSERT_NOT_NULL(c);
+        TEST_ASSERT(nanocoap_cache_key_lookup(c->cache_key) == c);
+    }
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES, stats.hits);
+    TEST_ASSERT_EQUAL_INT(2, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES,
+                          nanocoap_cache_used_count());
+}
+
+static void test_nanocoap_cache__expire(void)
+{
+    nanocoap_cache_stats_t stats;
+    nanocoap_cache_entry_t *c;
+    uint8_t key_plain[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    uint8_t key_etag[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    uint8_t key_fresh[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    char path[16];
+
+    nanocoap_cache_init();
+
+    c = _add("/plain", 0, NULL);
+    memcpy(key_plain, c->cache_key, sizeof(key_plain));
+    c = _add("/fresh", 60, NULL);
+    memcpy(key_fresh, c->cache_key, sizeof(key_fresh));
+    c = _add("/etag", 0, "abcd");
+    memcpy(key_etag, c->cache_key, sizeof(key_etag));
+    TEST_ASSERT_EQUAL_INT(3, nanocoap_cache_used_count());
+
+    ztimer_sleep(ZTIMER_SEC, 2);
+
+    /* the stale entry without ETag is gone on the next access */
+    TEST_ASSERT_NOT_NULL(nanocoap_cache_key_lookup(key_fresh));
+    TEST_ASSERT_EQUAL_INT(2, nanocoap_cache_used_count());
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(key_plain));
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.expirations);
+
+    /* the stale entry with ETag is kept, but replaced first */
+    for (unsigned i = 2; i <= CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_add(path, 60, NULL));
+    }
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(key_etag));
+    TEST_ASSERT_NOT_NULL(nanocoap_cache_key_lookup(key_fresh));
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+}
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -313,6 +424,8 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__stats),
+        new_TestFixture(test_nanocoap_cache__expire),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
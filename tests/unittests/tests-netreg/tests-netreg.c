@@ -182,6 +182,60 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_unregister__not_registered(void)
+{
+    /* must not crash on an empty registry */
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &entries[0]);
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    gnrc_netreg_release_shared();
+}
+
+void test_netreg_getnext__order(void)
+{
+    static gnrc_netreg_entry_t many[] = {
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + 1, TEST_UINT8 + 1),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 2),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + 2, TEST_UINT8 + 3),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 4),
+    };
+    gnrc_netreg_entry_t *res = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    gnrc_netreg_acquire_shared();
+    /* entries with the same demux context are found latest registered first */
+    TEST_ASSERT((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)) == &many[4]);
+    TEST_ASSERT((res = gnrc_netreg_getnext(res)) == &many[2]);
+    TEST_ASSERT((res = gnrc_netreg_getnext(res)) == &many[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + 2)) == &many[3]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[2]);
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+    gnrc_netreg_release_shared();
+}
+
+void test_netreg_getnext__diff_type(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entries[1]));
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    TEST_ASSERT((res = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16)) == &entries[1]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -198,6 +252,9 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_unregister__not_registered),
+        new_TestFixture(test_netreg_getnext__order),
+        new_TestFixture(test_netreg_getnext__diff_type),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -11,6 +11,7 @@
  */
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/uio.h>
 
 #include "embUnit.h"
@@ -202,6 +203,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_STATIC_SLAB  /* slabs reduce the arena */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -225,6 +227,7 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -246,7 +249,8 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+/* alignment-handling left to malloc or slab, so no certainty here */
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, ALIGNMENT_SIZE, GNRC_NETTYPE_TEST);
@@ -818,7 +822,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_STATIC_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -857,6 +861,80 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+static void test_pktbuf_slab__exhaust(void)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_PKTBUF_STATIC_SLAB_NUMOF + 2];
+
+    /* the last two packets are served from the arena */
+    for (unsigned i = 0; i < ARRAY_SIZE(pkts); i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, TEST_STRING16, 16, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, pkts[i]->data, 16));
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    for (unsigned i = 0; i < ARRAY_SIZE(pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, pkts[i]->data, 16));
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__reuse(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *snip = pkt;
+    void *data = pkt->data;
+
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING4, 4, GNRC_NETTYPE_TEST);
+    TEST_ASSERT(pkt == snip);
+    TEST_ASSERT(pkt->data == data);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__realloc_data(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING64,
+                                          CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE,
+                                          GNRC_NETTYPE_TEST);
+    void *data = pkt->data;
+
+    /* data stays in its slab object as long as it fits */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 4));
+    TEST_ASSERT(pkt->data == data);
+    TEST_ASSERT_EQUAL_INT(4, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE));
+    TEST_ASSERT(pkt->data == data);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, pkt->data, 4));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE + 1));
+    TEST_ASSERT(pkt->data != data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, pkt->data, 4));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__mark(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, 16, GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *marked = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(marked);
+    TEST_ASSERT(pkt->next == marked);
+    TEST_ASSERT_EQUAL_INT(8, marked->size);
+    TEST_ASSERT_EQUAL_INT(8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, marked->data, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16 + 8, pkt->data, 8));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -871,9 +949,11 @@ Test *tests_pktbuf_tests(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
+#ifndef MODULE_GNRC_PKTBUF_STATIC_SLAB
         new_TestFixture(test_pktbuf_add__success),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_STATIC_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -911,10 +991,16 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_STATIC_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
+#ifdef MODULE_GNRC_PKTBUF_STATIC_SLAB
+        new_TestFixture(test_pktbuf_slab__exhaust),
+        new_TestFixture(test_pktbuf_slab__reuse),
+        new_TestFixture(test_pktbuf_slab__realloc_data),
+        new_TestFixture(test_pktbuf_slab__mark),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
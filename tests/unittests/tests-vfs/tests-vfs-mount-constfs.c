@@ -34,6 +34,7 @@ static const uint8_t bin_data[] = {
 static const uint8_t str_data[] = "This is a test file";
                                 /* 01234567890123456789 */
                                 /* 0         1          */
+static const uint8_t lines_data[] = "first line\nsecond\n\nlast line";
 static const constfs_file_t _files[] = {
     {
         .path = "/test.txt",
@@ -45,6 +46,11 @@ static const constfs_file_t _files[] = {
         .data = bin_data,
         .size = sizeof(bin_data),
     },
+    {
+        .path = "/lines.txt",
+        .data = lines_data,
+        .size = sizeof(lines_data) - 1,
+    },
 };
 
 static const constfs_t fs_data = {
@@ -64,6 +70,38 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static vfs_mount_t _test_vfs_mount_ra = {
+    .mount_point = "/test",
+    .fs = &constfs_file_system,
+    .readahead = 8,
+    .private_data = (void *)&fs_data,
+};
+
+static const constfs_file_t _sub_files[] = {
+    {
+        .path = "/sub.bin",
+        .data = bin_data,
+        .size = 4,
+    },
+};
+
+static const constfs_t sub_fs_data = {
+    .files = _sub_files,
+    .nfiles = ARRAY_SIZE(_sub_files),
+};
+
+static vfs_mount_t _test_vfs_mount_sub = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&sub_fs_data,
+};
+
+static vfs_mount_t _test_vfs_mount_su = {
+    .mount_point = "/test/su",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&sub_fs_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -92,6 +130,45 @@ static void test_vfs_umount__invalid_mount(void)
     TEST_ASSERT(res < 0);
 }
 
+static void test_vfs_mount__nested(void)
+{
+    struct stat st;
+    int res;
+    res = vfs_mount(&_test_vfs_mount_sub);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount_su);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    /* longest matching mount point wins */
+    res = vfs_stat("/test/sub/sub.bin", &st);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(4, st.st_size);
+    res = vfs_stat("/test/su/sub.bin", &st);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/sub/test.txt", &st);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_stat("/test/test.txt", &st);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data), st.st_size);
+    /* mount point must end at a separator */
+    res = vfs_stat("/test/subs.bin", &st);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_stat("/tes/test.txt", &st);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount_sub, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/sub/sub.bin", &st);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount_su, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 static void test_vfs_constfs_open(void)
 {
     int res;
@@ -170,6 +247,111 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void _test_vfs_constfs_read_iol(vfs_mount_t *mountp)
+{
+    int res;
+    res = vfs_mount(mountp);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    uint8_t buf[3][24];
+    iolist_t iol[3] = {
+        { .iol_next = &iol[1], .iol_base = buf[0], .iol_len = 2 },
+        { .iol_next = &iol[2], .iol_base = buf[1], .iol_len = 12 },
+        { .iol_next = NULL, .iol_base = buf[2], .iol_len = 24 },
+    };
+
+    /* file is shorter than the iolist */
+    memset(buf, 0, sizeof(buf));
+    ssize_t nbytes = vfs_read_iol(fd, iol);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data), nbytes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf[0], &bin_data[0], 2));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf[1], &bin_data[2], 12));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf[2], &bin_data[14], sizeof(bin_data) - 14));
+
+    nbytes = vfs_read_iol(fd, iol);
+    TEST_ASSERT_EQUAL_INT(0, nbytes);
+
+    /* small reads and seeks relative to the read position */
+    off_t pos = vfs_lseek(fd, 1, SEEK_SET);
+    TEST_ASSERT_EQUAL_INT(1, pos);
+    nbytes = vfs_read(fd, buf[0], 3);
+    TEST_ASSERT_EQUAL_INT(3, nbytes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf[0], &bin_data[1], 3));
+    pos = vfs_lseek(fd, 0, SEEK_CUR);
+    TEST_ASSERT_EQUAL_INT(4, pos);
+    pos = vfs_lseek(fd, 2, SEEK_CUR);
+    TEST_ASSERT_EQUAL_INT(6, pos);
+    nbytes = vfs_read(fd, buf[0], 12);
+    TEST_ASSERT_EQUAL_INT(12, nbytes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf[0], &bin_data[6], 12));
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(mountp, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void _test_vfs_constfs_readline(vfs_mount_t *mountp)
+{
+    int res;
+    res = vfs_mount(mountp);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/lines.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    char line[16];
+    ssize_t nbytes = vfs_readline(fd, line, sizeof(line));
+    TEST_ASSERT_EQUAL_INT(sizeof("first line"), nbytes);
+    TEST_ASSERT_EQUAL_STRING("first line", line);
+    nbytes = vfs_readline(fd, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("second", line);
+    nbytes = vfs_readline(fd, line, sizeof(line));
+    TEST_ASSERT_EQUAL_INT(1, nbytes);
+    TEST_ASSERT_EQUAL_STRING("", line);
+    nbytes = vfs_readline(fd, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("last line", line);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(mountp, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void test_vfs_constfs_read_iol(void)
+{
+    _test_vfs_constfs_read_iol(&_test_vfs_mount);
+}
+
+static void test_vfs_constfs_readline(void)
+{
+    _test_vfs_constfs_readline(&_test_vfs_mount);
+}
+
+static void test_vfs_constfs_readahead(void)
+{
+    vfs_readahead_stats_t stats;
+
+    _test_vfs_constfs_read_iol(&_test_vfs_mount_ra);
+    _test_vfs_constfs_readline(&_test_vfs_mount_ra);
+
+    int res = vfs_readahead_stats(VFS_ANY_FD, &stats);
+    if (IS_USED(MODULE_VFS_READAHEAD)) {
+        TEST_ASSERT_EQUAL_INT(0, res);
+        /* 29 bytes read in 8 byte chunks, plus EOF */
+        TEST_ASSERT(stats.misses >= 4);
+        TEST_ASSERT(stats.hits > stats.misses);
+    }
+    else {
+        TEST_ASSERT_EQUAL_INT(-ENOTSUP, res);
+    }
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -207,8 +389,12 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_mount_umount),
         new_TestFixture(test_vfs_mount__invalid),
         new_TestFixture(test_vfs_umount__invalid_mount),
+        new_TestFixture(test_vfs_mount__nested),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_read_iol),
+        new_TestFixture(test_vfs_constfs_readline),
+        new_TestFixture(test_vfs_constfs_readahead),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif
@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for the ztimer pairing heap timer queue
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define NUMOF_ALARMS    (32U)
+
+static unsigned _log[NUMOF_ALARMS];
+static unsigned _log_len;
+static unsigned _idx[NUMOF_ALARMS];
+
+static void _cb_log(void *arg)
+{
+    unsigned *idx = arg;
+
+    if (_log_len < NUMOF_ALARMS) {
+        _log[_log_len] = *idx;
+    }
+    _log_len++;
+}
+
+static void _init_alarms(ztimer_t *alarms, unsigned numof)
+{
+    _log_len = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        _idx[i] = i;
+        alarms[i] = (ztimer_t){ .callback = _cb_log, .arg = &_idx[i] };
+    }
+}
+
+/* (i * 7) % 32 is a permutation of 0..31, scaled to get distinct targets */
+static uint32_t _target(unsigned i)
+{
+    return 100 + ((i * 7) % NUMOF_ALARMS) * 10;
+}
+
+/**
+ * @brief   Timers set in arbitrary order trigger in target order
+ */
+static void test_ztimer_heap_order(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[NUMOF_ALARMS];
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_heap_enable(z);
+    _init_alarms(alarms, NUMOF_ALARMS);
+
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        ztimer_set(z, &alarms[i], _target(i));
+    }
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        TEST_ASSERT(ztimer_is_set(z, &alarms[i]));
+    }
+
+    /* first target is 100 */
+    TEST_ASSERT(zmock.armed);
+    TEST_ASSERT_EQUAL_INT(100, zmock.target);
+
+    ztimer_mock_advance(&zmock, 99);
+    TEST_ASSERT_EQUAL_INT(0, _log_len);
+
+    for (unsigned n = 0; n < NUMOF_ALARMS; n++) {
+        ztimer_mock_advance(&zmock, n ? 10 : 1);
+        TEST_ASSERT_EQUAL_INT(n + 1, _log_len);
+        TEST_ASSERT_EQUAL_INT(100 + n * 10, _target(_log[n]));
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[_log[n]]));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, zmock.armed);
+}
+
+/**
+ * @brief   Timers with the same target all trigger in one go
+ */
+static void test_ztimer_heap_same_target(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[8];
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_heap_enable(z);
+    _init_alarms(alarms, ARRAY_SIZE(alarms));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        ztimer_set(z, &alarms[i], 500);
+    }
+
+    ztimer_mock_advance(&zmock, 499);
+    TEST_ASSERT_EQUAL_INT(0, _log_len);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(alarms), _log_len);
+}
+
+/**
+ * @brief   Removing the head, inner nodes and leaves keeps the heap intact
+ */
+static void test_ztimer_heap_remove(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[NUMOF_ALARMS];
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_heap_enable(z);
+    _init_alarms(alarms, NUMOF_ALARMS);
+
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        ztimer_set(z, &alarms[i], _target(i));
+    }
+
+    /* remove every third timer, including the head (alarm 0, target 100) */
+    unsigned removed = 0;
+    for (unsigned i = 0; i < NUMOF_ALARMS; i += 3) {
+        TEST_ASSERT(ztimer_remove(z, &alarms[i]));
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+        removed++;
+    }
+    /* removing an unset timer is a no-op */
+    TEST_ASSERT(!ztimer_remove(z, &alarms[0]));
+
+    /* head is now the alarm with target 110 */
+    TEST_ASSERT_EQUAL_INT(110, zmock.target);
+
+    ztimer_mock_advance(&zmock, 100 + NUMOF_ALARMS * 10);
+    TEST_ASSERT_EQUAL_INT(NUMOF_ALARMS - removed, _log_len);
+    for (unsigned n = 0; n < _log_len; n++) {
+        TEST_ASSERT(_log[n] % 3);
+        if (n) {
+            TEST_ASSERT(_target(_log[n - 1]) < _target(_log[n]));
+        }
+    }
+}
+
+/**
+ * @brief   Re-setting a set timer moves it within the heap
+ */
+static void test_ztimer_heap_reset(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[3];
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_heap_enable(z);
+    _init_alarms(alarms, ARRAY_SIZE(alarms));
+
+    ztimer_set(z, &alarms[0], 1000);
+    ztimer_set(z, &alarms[1], 2000);
+    ztimer_set(z, &alarms[2], 3000);
+
+    ztimer_mock_advance(&zmock, 500);
+    /* move alarm 2 to the front, alarm 0 to the back */
+    ztimer_set(z, &alarms[2], 100);
+    ztimer_set(z, &alarms[0], 4000);
+    TEST_ASSERT_EQUAL_INT(100, zmock.target);
+
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(1, _log_len);
+    TEST_ASSERT_EQUAL_INT(2, _log[0]);
+
+    ztimer_mock_advance(&zmock, 1400);
+    TEST_ASSERT_EQUAL_INT(2, _log_len);
+    TEST_ASSERT_EQUAL_INT(1, _log[1]);
+
+    ztimer_mock_advance(&zmock, 2499);
+    TEST_ASSERT_EQUAL_INT(2, _log_len);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, _log_len);
+    TEST_ASSERT_EQUAL_INT(0, _log[2]);
+}
+
+/**
+ * @brief   The heap works with extended clocks and 32 bit wrap around
+ */
+static void test_ztimer_heap_extend16(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[3];
+
+    ztimer_mock_init(&zmock, 16);
+    ztimer_heap_enable(z);
+    _init_alarms(alarms, ARRAY_SIZE(alarms));
+
+    /* make sure ztimer stays turned on */
+    ztimer_acquire(z);
+
+    ztimer_mock_advance(&zmock, 0xfffffff0ul);
+    ztimer_set(z, &alarms[0], 0x40000000ul);
+    ztimer_set(z, &alarms[1], 0x10001ul);
+    ztimer_set(z, &alarms[2], 0x20ul);
+
+    ztimer_mock_advance(&zmock, 0x20);
+    TEST_ASSERT_EQUAL_INT(1, _log_len);
+    TEST_ASSERT_EQUAL_INT(2, _log[0]);
+
+    ztimer_mock_advance(&zmock, 0xffe0);
+    TEST_ASSERT_EQUAL_INT(1, _log_len);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, _log_len);
+    TEST_ASSERT_EQUAL_INT(1, _log[1]);
+
+    ztimer_mock_advance(&zmock, 0x40000000ul - 0x10002ul);
+    TEST_ASSERT_EQUAL_INT(2, _log_len);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, _log_len);
+    TEST_ASSERT_EQUAL_INT(0, _log[2]);
+
+    ztimer_release(z);
+}
+
+Test *tests_ztimer_heap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_heap_order),
+        new_TestFixture(test_ztimer_heap_same_target),
+        new_TestFixture(test_ztimer_heap_remove),
+        new_TestFixture(test_ztimer_heap_reset),
+        new_TestFixture(test_ztimer_heap_extend16),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */